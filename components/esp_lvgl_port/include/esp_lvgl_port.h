@@ -53,12 +53,68 @@ typedef struct {
     int task_affinity;      /*!< LVGL task pinned to core (-1 is no affinity) */
     int task_max_sleep_ms;  /*!< Maximum sleep in LVGL task */
     int timer_period_ms;    /*!< LVGL timer tick period in ms */
+#if LVGL_VERSION_MAJOR >= 9
+    bool tickless;          /*!< LVGL time is read from esp_timer, no periodic tick timer (LVGL 9.1 and newer, timer_period_ms is not used) */
+    int draw_task_priority; /*!< Priority of LVGL draw tasks (0 = same as LVGL task), only with esp_lvgl_port_os.h (CONFIG_LV_OS_CUSTOM) */
+    int draw_task_stack;    /*!< Stack size of LVGL draw tasks (0 = LVGL default), only with esp_lvgl_port_os.h (CONFIG_LV_OS_CUSTOM) */
+    int draw_task_affinity; /*!< Cores of LVGL draw tasks as bit mask (BIT(n) = core n). Draw tasks are spread over the cores in the mask, the first one on the other core than LVGL task. 0 and -1 = all cores */
+#endif
 } lvgl_port_cfg_t;
 
+#if LVGL_VERSION_MAJOR >= 9
+/**
+ * @brief Performance counters of the LVGL task
+ *
+ * Counters are accumulated since lvgl_port_init() or since the last lvgl_port_reset_stats().
+ */
+typedef struct {
+    uint32_t lock_count;        /*!< Number of taken LVGL mutexes (lvgl_port_lock) */
+    uint64_t lock_wait_us;      /*!< Time spent waiting for the LVGL mutex */
+    uint32_t lock_wait_max_us;  /*!< The longest wait for the LVGL mutex */
+    uint32_t indev_reads;       /*!< Number of input device reads, triggered by input events */
+    uint64_t indev_read_us;     /*!< Time of input device reads, triggered by input events */
+    uint64_t timer_handler_us;  /*!< Time spent in lv_timer_handler() (rendering, flushing and LVGL timers) */
+} lvgl_port_stats_t;
+
+/**
+ * @brief Number of buckets of the LVGL mutex histograms: <10 us, <100 us, <1 ms, <10 ms, <100 ms, >=100 ms
+ */
+#define LVGL_PORT_LOCK_HIST_BUCKETS (6)
+
+/**
+ * @brief LVGL mutex profile of one task (CONFIG_LVGL_PORT_LOCK_PROFILING)
+ *
+ * Nested (recursive) locks are counted once, the hold time is measured from the outermost lock to the last unlock.
+ */
+typedef struct {
+    char     task_name[16];     /*!< Name of the task, which took the mutex ("other" for tasks over the limit) */
+    uint32_t count;             /*!< Number of acquisitions */
+    uint32_t contended;         /*!< Acquisitions, when the mutex was held by another task */
+    uint64_t wait_us;           /*!< Time spent waiting for the mutex */
+    uint32_t wait_max_us;       /*!< The longest wait */
+    uint64_t hold_us;           /*!< Time the mutex was held */
+    uint32_t hold_max_us;       /*!< The longest hold */
+    void     *hold_max_call_site[2];    /*!< Caller of lvgl_port_lock and its caller at the longest hold (NULL if unknown) */
+    uint32_t wait_hist[LVGL_PORT_LOCK_HIST_BUCKETS];    /*!< Histogram of wait times */
+    uint32_t hold_hist[LVGL_PORT_LOCK_HIST_BUCKETS];    /*!< Histogram of hold times */
+} lvgl_port_lock_stats_t;
+#endif
+
 /**
  * @brief LVGL port configuration structure
  *
  */
+#if LVGL_VERSION_MAJOR >= 9
+#define ESP_LVGL_PORT_INIT_CONFIG() \
+    {                               \
+        .task_priority = 4,       \
+        .task_stack = 6144,       \
+        .task_affinity = -1,      \
+        .task_max_sleep_ms = 500, \
+        .timer_period_ms = 5,     \
+        .draw_task_affinity = -1, \
+    }
+#else
 #define ESP_LVGL_PORT_INIT_CONFIG() \
     {                               \
         .task_priority = 4,       \
@@ -67,6 +123,7 @@ typedef struct {
         .task_max_sleep_ms = 500, \
         .timer_period_ms = 5,     \
     }
+#endif
 
 /**
  * @brief Initialize LVGL portation
@@ -142,6 +199,8 @@ esp_err_t lvgl_port_resume(void);
  * @brief Notify LVGL task, that display need reload
  *
  * @note It is called from LVGL events and touch interrupts
+ * @note LVGL9: The events are coalesced, the LVGL task handles all events received since its last run at once.
+ *       With LVGL_PORT_EVENT_TOUCH, param is the input device to read (NULL means all input devices).
  *
  * @param event     event type
  * @param param     user param
@@ -152,6 +211,51 @@ esp_err_t lvgl_port_resume(void);
  */
 esp_err_t lvgl_port_task_wake(lvgl_port_event_type_t event, void *param);
 
+#if LVGL_VERSION_MAJOR >= 9
+/**
+ * @brief Get performance counters of the LVGL task
+ *
+ * @note Counters of the displays are in lvgl_port_get_disp_stats().
+ *
+ * @param stats Output counters
+ * @return
+ *      - ESP_OK                    on success
+ *      - ESP_ERR_INVALID_ARG       if stats is NULL
+ */
+esp_err_t lvgl_port_get_stats(lvgl_port_stats_t *stats);
+
+/**
+ * @brief Reset performance counters of the LVGL task
+ */
+void lvgl_port_reset_stats(void);
+
+/**
+ * @brief Get LVGL mutex profile of all tasks, which took the mutex
+ *
+ * @note It needs CONFIG_LVGL_PORT_LOCK_PROFILING.
+ *
+ * @param stats Output array of profiles
+ * @param count In: size of the stats array, out: number of filled profiles
+ * @return
+ *      - ESP_OK                    on success
+ *      - ESP_ERR_INVALID_ARG       if some of the arguments are not valid
+ *      - ESP_ERR_NOT_SUPPORTED     if the profiling is not enabled
+ */
+esp_err_t lvgl_port_get_lock_stats(lvgl_port_lock_stats_t *stats, uint32_t *count);
+
+/**
+ * @brief Reset LVGL mutex profile
+ */
+void lvgl_port_reset_lock_stats(void);
+
+/**
+ * @brief Print LVGL mutex profile to the log
+ *
+ * @note It is called periodically from LVGL task, when CONFIG_LVGL_PORT_LOCK_PROFILING_LOG_PERIOD_MS is not 0.
+ */
+void lvgl_port_print_lock_stats(void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -48,11 +48,15 @@ typedef struct {
     uint32_t    hres;           /*!< LCD display horizontal resolution */
     uint32_t    vres;           /*!< LCD display vertical resolution */
 
-    bool        monochrome;     /*!< True, if display is monochrome and using 1bit for 1px */
+    bool        monochrome;     /*!< True, if display is monochrome and using 1bit for 1px (LVGL9: vres must be multiple of 8, partial buffer can be used) */
 
     lvgl_port_rotation_cfg_t rotation;      /*!< Default values of the screen rotation */
 #if LVGL_VERSION_MAJOR >= 9
     lv_color_format_t        color_format;  /*!< The color format of the display */
+    uint32_t                 trans_overhead_px; /*!< Cost of one draw_bitmap transaction expressed in pixels, used for merging areas (0 = default) */
+    int                      flush_task_priority; /*!< Priority of the own flush task of the display (0 = display is flushed in LVGL task) */
+    int                      flush_task_stack;    /*!< Stack size of the own flush task (0 = default) */
+    int                      flush_task_affinity; /*!< Core of own flush task as bit mask (BIT(n) = pinned to core n, 0 and -1 = no affinity) */
 #endif
     struct {
         unsigned int buff_dma: 1;    /*!< Allocated LVGL buffer will be DMA capable */
@@ -63,6 +67,11 @@ typedef struct {
 #endif
         unsigned int full_refresh: 1;/*!< 1: Always make the whole screen redrawn */
         unsigned int direct_mode: 1; /*!< 1: Use screen-sized buffers and draw to absolute coordinates */
+#if LVGL_VERSION_MAJOR >= 9
+        unsigned int merge_areas: 1; /*!< 1: Merge invalidated areas before rendering, when it saves draw_bitmap transactions (not used with full_refresh) */
+        unsigned int buff_pool: 1;   /*!< 1: Use draw and rotation buffers from the shared buffer pool (lvgl_port_buff_pool_init), buff_dma and buff_spiram are not used */
+        unsigned int pipelined_rotation: 1; /*!< 1: Allocate second SW rotation buffer, rotation of the next area overlaps the transfer (only lvgl_port_add_disp, needs sw_rotate) */
+#endif
     } flags;
 } lvgl_port_display_cfg_t;
 
@@ -73,6 +82,9 @@ typedef struct {
     struct {
         unsigned int bb_mode: 1;        /*!< 1: Use bounce buffer mode */
         unsigned int avoid_tearing: 1;  /*!< 1: Use internal RGB buffers as a LVGL draw buffers to avoid tearing effect, enabling this option requires over two LCD buffers and may reduce the frame rate */
+#if LVGL_VERSION_MAJOR >= 9
+        unsigned int triple_buffer: 1;  /*!< 1: Use three RGB buffers, LVGL doesn't wait for vsync (requires avoid_tearing, full_refresh and num_fbs = 3 in the RGB panel) */
+#endif
     } flags;
 } lvgl_port_display_rgb_cfg_t;
 
@@ -82,9 +94,41 @@ typedef struct {
 typedef struct {
     struct {
         unsigned int avoid_tearing: 1;  /*!< 1: Use internal MIPI-DSI buffers as a LVGL draw buffers to avoid tearing effect, enabling this option requires over two LCD buffers and may reduce the frame rate */
+#if LVGL_VERSION_MAJOR >= 9
+        unsigned int triple_buffer: 1;  /*!< 1: Use three MIPI-DSI buffers, LVGL doesn't wait for vsync (requires avoid_tearing, full_refresh and num_fbs = 3 in the DPI panel) */
+#endif
     } flags;
 } lvgl_port_display_dsi_cfg_t;
 
+#if LVGL_VERSION_MAJOR >= 9
+/**
+ * @brief Performance counters of one display
+ *
+ * Counters are accumulated since adding the display or since the last lvgl_port_reset_disp_stats().
+ */
+typedef struct {
+    uint32_t frames;            /*!< Number of rendered frames */
+    uint32_t flushes;           /*!< Number of flush callbacks */
+    uint32_t dropped_frames;    /*!< Frames replaced before they were displayed (only triple buffering) */
+    uint64_t bytes_sent;        /*!< Bytes passed to esp_lcd_panel_draw_bitmap() */
+    uint64_t frame_time_us;     /*!< Time from the start of refresh to the end of the last flush of the frame */
+    uint32_t frame_time_max_us; /*!< The longest frame */
+    uint64_t render_time_us;    /*!< Frame time without the flushing (time of LVGL rendering) */
+    uint64_t wait_time_us;      /*!< Time blocked on the panel: transfer done, vsync or free rotation buffer */
+    uint64_t convert_time_us;   /*!< Time of SW rotation, swap bytes and monochrome pixels packing */
+    float fps;                  /*!< Frames per second in the last window (1 second) */
+} lvgl_port_disp_stats_t;
+
+/**
+ * @brief Configuration of the shared buffer pool
+ */
+typedef struct {
+    size_t      buff_size;      /*!< Size of one buffer in bytes (draw buffer of the largest display) */
+    uint32_t    buff_count;     /*!< Number of buffers (draw buffers and rotation buffers of one display) */
+    uint32_t    caps;           /*!< Memory capabilities of the buffers (MALLOC_CAP_DMA, MALLOC_CAP_SPIRAM...) */
+} lvgl_port_buff_pool_cfg_t;
+#endif
+
 /**
  * @brief Add I2C/SPI/I8080 display handling to LVGL
  *
@@ -127,6 +171,55 @@ lv_display_t *lvgl_port_add_disp_rgb(const lvgl_port_display_cfg_t *disp_cfg, co
  */
 esp_err_t lvgl_port_remove_disp(lv_display_t *disp);
 
+#if LVGL_VERSION_MAJOR >= 9
+/**
+ * @brief Create buffer pool shared by displays
+ *
+ * Displays added with the buff_pool flag don't allocate their own draw and rotation buffers, they use buffers from
+ * the pool. All the displays use the same buffers (LVGL renders only one display at a time), so the memory is needed
+ * only for the largest display. The buffers stay allocated, when the displays are removed and added again.
+ *
+ * @note It must be called before adding the displays.
+ *
+ * @param cfg Buffer pool configuration
+ * @return
+ *      - ESP_OK                    on success
+ *      - ESP_ERR_INVALID_ARG       if some of the arguments are not valid
+ *      - ESP_ERR_INVALID_STATE     if the pool already exists
+ *      - ESP_ERR_NO_MEM            if memory allocation fails
+ */
+esp_err_t lvgl_port_buff_pool_init(const lvgl_port_buff_pool_cfg_t *cfg);
+
+/**
+ * @brief Free the buffer pool
+ *
+ * @return
+ *      - ESP_OK                    on success
+ *      - ESP_ERR_INVALID_STATE     if the pool is still used by any display
+ */
+esp_err_t lvgl_port_buff_pool_deinit(void);
+
+/**
+ * @brief Get performance counters of the display
+ *
+ * @note The counters are cheap (esp_timer based), they are always enabled.
+ *
+ * @param disp  LVGL display handle (returned from lvgl_port_add_disp)
+ * @param stats Output counters
+ * @return
+ *      - ESP_OK                    on success
+ *      - ESP_ERR_INVALID_ARG       if some of the arguments are not valid
+ */
+esp_err_t lvgl_port_get_disp_stats(lv_display_t *disp, lvgl_port_disp_stats_t *stats);
+
+/**
+ * @brief Reset performance counters of the display
+ *
+ * @param disp  LVGL display handle (returned from lvgl_port_add_disp)
+ */
+void lvgl_port_reset_disp_stats(lv_display_t *disp);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
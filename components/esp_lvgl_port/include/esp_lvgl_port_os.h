@@ -0,0 +1,59 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief ESP LVGL port OS abstraction layer (LV_OS_CUSTOM)
+ *
+ * LVGL threads (software draw units) are FreeRTOS tasks, which are created with priority, stack size and core
+ * affinity from the LVGL port configuration (draw_task_priority, draw_task_stack and draw_task_affinity in lvgl_port_cfg_t).
+ * The threads are spread over the cores in draw_task_affinity mask by their index.
+ *
+ * This header is included by LVGL, it is selected by Kconfig options:
+ *  - CONFIG_LV_OS_CUSTOM=y
+ *  - CONFIG_LV_OS_CUSTOM_INCLUDE="esp_lvgl_port_os.h"
+ *  - CONFIG_LV_DRAW_SW_DRAW_UNIT_CNT=2 (number of draw tasks)
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if !CONFIG_LV_OS_CUSTOM
+#warning "esp_lvgl_port_os.h included, but CONFIG_LV_OS_CUSTOM not set. LVGL port OS abstraction layer not used"
+#else
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    TaskHandle_t task;                  /* FreeRTOS task of the thread */
+    uint32_t index;                     /* Index of the thread, selects its core (draw_task_affinity) */
+    void (*callback)(void *);           /* Thread function */
+    void *user_data;                    /* Thread function argument */
+} lv_thread_t;
+
+typedef struct {
+    SemaphoreHandle_t mutex;            /* Recursive mutex */
+} lv_mutex_t;
+
+typedef struct {
+    SemaphoreHandle_t sem;              /* Binary semaphore, a signal is kept until the wait */
+} lv_thread_sync_t;
+
+#endif /* CONFIG_LV_OS_CUSTOM */
+
+#ifdef __cplusplus
+}
+#endif
@@ -34,6 +34,12 @@ extern "C" {
 typedef struct {
     lv_display_t *disp;    /*!< LVGL display handle (returned from lvgl_port_add_disp) */
     esp_lcd_touch_handle_t   handle;   /*!< LCD touch IO handle */
+#if LVGL_VERSION_MAJOR >= 9
+    int      sample_task_priority;  /*!< Priority of the touch sampling task (0 = touch is read in LVGL task) */
+    int      sample_task_stack;     /*!< Stack size of the touch sampling task (0 = default) */
+    int      sample_task_affinity;  /*!< Touch sampling task pinned to core (-1 is no affinity) */
+    uint32_t sample_period_ms;      /*!< Period of reading the touch by the sampling task, while it is pressed or without interrupt (0 = default) */
+#endif
 } lvgl_port_touch_cfg_t;
 
 /**
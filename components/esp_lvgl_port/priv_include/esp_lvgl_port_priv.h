@@ -29,8 +29,36 @@ typedef enum {
  */
 typedef struct {
     unsigned int avoid_tearing: 1;    /*!< Use internal RGB buffers as a LVGL draw buffers to avoid tearing effect */
+    unsigned int pipelined_rotation: 1; /*!< Use two SW rotation buffers and release LVGL buffer right after rotation (needs transfer done callback) */
+    unsigned int triple_buffer: 1;    /*!< Use three internal RGB/DSI buffers, render/pending/scanout (only with avoid_tearing and full_refresh) */
 } lvgl_port_disp_priv_cfg_t;
 
+/**
+ * @brief Configuration of one LVGL thread (draw task)
+ */
+typedef struct {
+    int priority;   /*!< Task priority (0 = LVGL default) */
+    int stack;      /*!< Task stack size (0 = LVGL default) */
+    int core;       /*!< Task pinned to core (-1 = no affinity) */
+} lvgl_port_thread_cfg_t;
+
+/**
+ * @brief Get configuration of LVGL thread
+ *
+ * @note It is called from the LVGL port OS abstraction layer, when LVGL creates a thread
+ *
+ * @param index     index of the thread (lowest index not used by running threads)
+ * @param cfg       output configuration
+ */
+void lvgl_port_get_thread_cfg(uint32_t index, lvgl_port_thread_cfg_t *cfg);
+
+/**
+ * @brief Resume refresh timers of displays, which have finished the frame in their own flush task
+ *
+ * @note It must be called from LVGL task (with LVGL mutex taken)
+ */
+void lvgl_port_disp_refr_resume(void);
+
 /**
  * @brief Notify LVGL task
  *
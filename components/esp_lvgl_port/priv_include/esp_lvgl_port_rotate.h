@@ -0,0 +1,99 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief ESP LVGL port software rotation
+ *
+ * Rotation kernels used for SW rotation of the flushed areas. The image is processed in tiles, so the source and the
+ * destination rows touched by one tile stay in cache (important for buffers in PSRAM). There are word-level paths
+ * for RGB565 (2x2 pixels) and RGB888 (4x4 pixels), used when the buffers and strides are 4-byte aligned.
+ * The RGB565 kernel can also swap bytes of the pixels in the same pass (for big-endian LCDs), or pack the image into
+ * the 1-bit page format of monochrome controllers.
+ *
+ * The kernels do not depend on LVGL.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Clockwise rotation of the image
+ */
+typedef enum {
+    LVGL_PORT_ROTATE_0 = 0,     /*!< No rotation (copy) */
+    LVGL_PORT_ROTATE_90,        /*!< Rotation by 90° clockwise: dst[x][h - 1 - y] = src[y][x] */
+    LVGL_PORT_ROTATE_180,       /*!< Rotation by 180°: dst[h - 1 - y][w - 1 - x] = src[y][x] */
+    LVGL_PORT_ROTATE_270,       /*!< Rotation by 270° clockwise: dst[w - 1 - x][y] = src[y][x] */
+} lvgl_port_rotate_t;
+
+/**
+ * @brief Rotate RGB565 image and optionally swap bytes of the pixels
+ *
+ * @param src           Source image
+ * @param dst           Destination image (must not overlap with the source)
+ * @param w             Width of the source image in pixels
+ * @param h             Height of the source image in pixels
+ * @param src_stride    Stride of the source image in bytes
+ * @param dst_stride    Stride of the destination image in bytes
+ * @param rotation      Rotation
+ * @param swap_bytes    Swap bytes of each pixel
+ */
+void lvgl_port_rotate_rgb565(const uint16_t *src, uint16_t *dst, int32_t w, int32_t h, int32_t src_stride, int32_t dst_stride, lvgl_port_rotate_t rotation, bool swap_bytes);
+
+/**
+ * @brief Rotate RGB888 image
+ *
+ * @param src           Source image
+ * @param dst           Destination image (must not overlap with the source)
+ * @param w             Width of the source image in pixels
+ * @param h             Height of the source image in pixels
+ * @param src_stride    Stride of the source image in bytes
+ * @param dst_stride    Stride of the destination image in bytes
+ * @param rotation      Rotation
+ */
+void lvgl_port_rotate_rgb888(const uint8_t *src, uint8_t *dst, int32_t w, int32_t h, int32_t src_stride, int32_t dst_stride, lvgl_port_rotate_t rotation);
+
+/**
+ * @brief Rotate 32-bit image (ARGB8888, XRGB8888)
+ *
+ * @param src           Source image
+ * @param dst           Destination image (must not overlap with the source)
+ * @param w             Width of the source image in pixels
+ * @param h             Height of the source image in pixels
+ * @param src_stride    Stride of the source image in bytes
+ * @param dst_stride    Stride of the destination image in bytes
+ * @param rotation      Rotation
+ */
+void lvgl_port_rotate_argb8888(const uint32_t *src, uint32_t *dst, int32_t w, int32_t h, int32_t src_stride, int32_t dst_stride, lvgl_port_rotate_t rotation);
+
+/**
+ * @brief Rotate RGB565 image and pack it into 1-bit vertical pages (SSD1306, SH1107 and similar controllers)
+ *
+ * One byte of the destination holds 8 vertical pixels of one column, LSB is the top pixel. Pages are stored one after
+ * another. Dark pixels (no color channel with the MSB set) are stored as 1, light pixels as 0.
+ *
+ * @note Height of the destination image (h for 0° and 180°, w for 90° and 270°) must be a multiple of 8.
+ *
+ * @param src           Source image
+ * @param dst           Destination pages (must not overlap with the source)
+ * @param w             Width of the source image in pixels
+ * @param h             Height of the source image in pixels
+ * @param src_stride    Stride of the source image in bytes
+ * @param dst_stride    Size of one destination page in bytes (width of the destination image)
+ * @param rotation      Rotation
+ */
+void lvgl_port_rotate_rgb565_to_pages(const uint16_t *src, uint8_t *dst, int32_t w, int32_t h, int32_t src_stride, int32_t dst_stride, lvgl_port_rotate_t rotation);
+
+#ifdef __cplusplus
+}
+#endif
@@ -5,11 +5,17 @@
  */
 
 #include <string.h>
+#include <limits.h>
+#include <stddef.h>
+#include <inttypes.h>
+#include <sys/param.h>
 #include "esp_system.h"
+#include "esp_attr.h"
 #include "esp_log.h"
 #include "esp_err.h"
 #include "esp_check.h"
 #include "esp_timer.h"
+#include "sdkconfig.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/portmacro.h"
 #include "freertos/task.h"
@@ -22,20 +28,72 @@ static const char *TAG = "LVGL";
 
 #define ESP_LVGL_PORT_TASK_MUX_DELAY_MS    10000
 
+/* LVGL task gives one tick to lower priority tasks, only when it didn't sleep for this time */
+#define ESP_LVGL_PORT_TASK_MAX_BUSY_MS      10
+
+/* Bits of the LVGL task notification */
+#define ESP_LVGL_PORT_NOTIFY_DISPLAY        (1 << 0)
+#define ESP_LVGL_PORT_NOTIFY_INDEV          (1 << 1)
+#define ESP_LVGL_PORT_NOTIFY_USER           (1 << 2)
+
+/* Input devices with own bit in the pending bitmap, the last bit means "read all input devices" */
+#define ESP_LVGL_PORT_MAX_INDEVS            31
+#define ESP_LVGL_PORT_INDEV_ALL             (1UL << ESP_LVGL_PORT_MAX_INDEVS)
+
+#if CONFIG_LVGL_PORT_LOCK_PROFILING
+#if CONFIG_IDF_TARGET_ARCH_XTENSA
+#include "esp_debug_helpers.h"
+/* Return address on the stack contains window size in the top bits (same as esp_cpu_process_stack_pc) */
+#define ESP_LVGL_PORT_STACK_PC(pc)          ((((pc) & 0x80000000) ? (((pc) & 0x3fffffff) | 0x40000000) : (pc)) - 3)
+#endif
+#define ESP_LVGL_PORT_LOCK_CALLERS          CONFIG_LVGL_PORT_LOCK_PROFILING_CALLERS
+#endif
+
+/* Tick callback (tickless mode) is available from LVGL 9.1 */
+#define ESP_LVGL_PORT_TICK_CB_SUPPORTED     (LVGL_VERSION_MAJOR > 9 || LVGL_VERSION_MINOR >= 1)
+
+/* All cores (draw task affinity mask) */
+#define ESP_LVGL_PORT_CORES_MASK            ((1UL << configNUM_CORES) - 1)
+
 /*******************************************************************************
 * Types definitions
 *******************************************************************************/
 
+#if CONFIG_LVGL_PORT_LOCK_PROFILING
+typedef struct {
+    TaskHandle_t            tasks[ESP_LVGL_PORT_LOCK_CALLERS];  /* Profiled tasks, index is the slot in callers */
+    lvgl_port_lock_stats_t  callers[ESP_LVGL_PORT_LOCK_CALLERS];
+    uint32_t                callers_cnt;
+    uint32_t                depth;          /* Nesting of the recursive mutex */
+    lvgl_port_lock_stats_t  *holder;        /* Profile of the task holding the mutex */
+    int64_t                 hold_start;     /* Time of the outermost lock in us */
+    void                    *call_site[2];  /* Call site of the outermost lock */
+    int64_t                 last_log;       /* Time of the last periodic log in us */
+} lvgl_port_lock_prof_t;
+#endif
+
 typedef struct lvgl_port_ctx_s {
     TaskHandle_t        lvgl_task;
     SemaphoreHandle_t   lvgl_mux;
     SemaphoreHandle_t   timer_mux;
-    QueueHandle_t       lvgl_queue;
     SemaphoreHandle_t   task_init_mux;
     esp_timer_handle_t  tick_timer;
     bool                running;
     int                 task_max_sleep_ms;
+    int                 task_priority;
+    int                 task_affinity;
+    int                 draw_task_priority;
+    int                 draw_task_stack;
+    int                 draw_task_affinity;
     int                 timer_period_ms;
+    bool                tickless;   /* LVGL time is read from esp_timer, no periodic tick timer */
+    lvgl_port_stats_t   stats;      /* Performance counters (protected by LVGL mutex) */
+    portMUX_TYPE        indev_lock; /* Lock of the input devices pending bitmap, shared with ISRs */
+    lv_indev_t          *indevs[ESP_LVGL_PORT_MAX_INDEVS];  /* Input devices woken by events, index is the bit in indev_pending */
+    uint32_t            indev_pending;  /* Input devices to be read in the next task run */
+#if CONFIG_LVGL_PORT_LOCK_PROFILING
+    lvgl_port_lock_prof_t   lock_prof;  /* LVGL mutex profile (protected by LVGL mutex) */
+#endif
 } lvgl_port_ctx_t;
 
 /*******************************************************************************
@@ -49,6 +107,12 @@ static lvgl_port_ctx_t lvgl_port_ctx;
 static void lvgl_port_task(void *arg);
 static esp_err_t lvgl_port_tick_init(void);
 static void lvgl_port_task_deinit(void);
+static void lvgl_port_indev_set_pending(lv_indev_t *indev);
+static void lvgl_port_indev_read_pending(void);
+#if CONFIG_LVGL_PORT_LOCK_PROFILING
+static void lvgl_port_lock_prof_acquired(uint32_t wait, bool contended, void *const call_site[2]);
+static void lvgl_port_lock_prof_release(void);
+#endif
 
 /*******************************************************************************
 * Public API functions
@@ -59,28 +123,42 @@ esp_err_t lvgl_port_init(const lvgl_port_cfg_t *cfg)
     esp_err_t ret = ESP_OK;
     ESP_GOTO_ON_FALSE(cfg, ESP_ERR_INVALID_ARG, err, TAG, "invalid argument");
     ESP_GOTO_ON_FALSE(cfg->task_affinity < (configNUM_CORES), ESP_ERR_INVALID_ARG, err, TAG, "Bad core number for task! Maximum core number is %d", (configNUM_CORES - 1));
+    ESP_GOTO_ON_FALSE(cfg->draw_task_affinity == -1 || (cfg->draw_task_affinity & ~ESP_LVGL_PORT_CORES_MASK) == 0, ESP_ERR_INVALID_ARG, err, TAG, "Bad core mask for draw tasks! Maximum core number is %d", (configNUM_CORES - 1));
 
     memset(&lvgl_port_ctx, 0, sizeof(lvgl_port_ctx));
+    portMUX_INITIALIZE(&lvgl_port_ctx.indev_lock);
 
     /* Tick init */
     lvgl_port_ctx.timer_period_ms = cfg->timer_period_ms;
+#if ESP_LVGL_PORT_TICK_CB_SUPPORTED
+    lvgl_port_ctx.tickless = cfg->tickless;
+#else
+    if (cfg->tickless) {
+        ESP_LOGW(TAG, "Tickless mode needs LVGL 9.1 or newer, periodic tick timer is used.");
+    }
+#endif
     /* Create task */
     lvgl_port_ctx.task_max_sleep_ms = cfg->task_max_sleep_ms;
     if (lvgl_port_ctx.task_max_sleep_ms == 0) {
         lvgl_port_ctx.task_max_sleep_ms = 500;
     }
-    /* Timer semaphore */
-    lvgl_port_ctx.timer_mux = xSemaphoreCreateMutex();
-    ESP_GOTO_ON_FALSE(lvgl_port_ctx.timer_mux, ESP_ERR_NO_MEM, err, TAG, "Create timer mutex fail!");
+    lvgl_port_ctx.task_priority = cfg->task_priority;
+    lvgl_port_ctx.task_affinity = cfg->task_affinity;
+    /* Draw tasks (created by LVGL in lv_init, only with LVGL port OS abstraction layer) */
+    lvgl_port_ctx.draw_task_priority = cfg->draw_task_priority;
+    lvgl_port_ctx.draw_task_stack = cfg->draw_task_stack;
+    lvgl_port_ctx.draw_task_affinity = cfg->draw_task_affinity;
+    /* Timer semaphore (tick timer only) */
+    if (!lvgl_port_ctx.tickless) {
+        lvgl_port_ctx.timer_mux = xSemaphoreCreateMutex();
+        ESP_GOTO_ON_FALSE(lvgl_port_ctx.timer_mux, ESP_ERR_NO_MEM, err, TAG, "Create timer mutex fail!");
+    }
     /* LVGL semaphore */
     lvgl_port_ctx.lvgl_mux = xSemaphoreCreateRecursiveMutex();
     ESP_GOTO_ON_FALSE(lvgl_port_ctx.lvgl_mux, ESP_ERR_NO_MEM, err, TAG, "Create LVGL mutex fail!");
     /* Task init semaphore */
     lvgl_port_ctx.task_init_mux = xSemaphoreCreateMutex();
     ESP_GOTO_ON_FALSE(lvgl_port_ctx.task_init_mux, ESP_ERR_NO_MEM, err, TAG, "Create LVGL task sem fail!");
-    /* Task queue */
-    lvgl_port_ctx.lvgl_queue = xQueueCreate(100, sizeof(lvgl_port_event_t));
-    ESP_GOTO_ON_FALSE(lvgl_port_ctx.lvgl_queue, ESP_ERR_NO_MEM, err, TAG, "Create LVGL queue fail!");
 
     BaseType_t res;
     if (cfg->task_affinity < 0) {
@@ -102,7 +180,10 @@ esp_err_t lvgl_port_resume(void)
 {
     esp_err_t ret = ESP_ERR_INVALID_STATE;
 
-    if (lvgl_port_ctx.tick_timer != NULL) {
+    if (lvgl_port_ctx.tickless) {
+        lv_timer_enable(true);
+        ret = ESP_OK;
+    } else if (lvgl_port_ctx.tick_timer != NULL) {
         lv_timer_enable(true);
         ret = esp_timer_start_periodic(lvgl_port_ctx.tick_timer, lvgl_port_ctx.timer_period_ms * 1000);
     }
@@ -114,7 +195,10 @@ esp_err_t lvgl_port_stop(void)
 {
     esp_err_t ret = ESP_ERR_INVALID_STATE;
 
-    if (lvgl_port_ctx.tick_timer != NULL) {
+    if (lvgl_port_ctx.tickless) {
+        lv_timer_enable(false);
+        ret = ESP_OK;
+    } else if (lvgl_port_ctx.tick_timer != NULL) {
         lv_timer_enable(false);
         ret = esp_timer_stop(lvgl_port_ctx.tick_timer);
     }
@@ -153,62 +237,197 @@ bool lvgl_port_lock(uint32_t timeout_ms)
     assert(lvgl_port_ctx.lvgl_mux && "lvgl_port_init must be called first");
 
     const TickType_t timeout_ticks = (timeout_ms == 0) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
-    return xSemaphoreTakeRecursive(lvgl_port_ctx.lvgl_mux, timeout_ticks) == pdTRUE;
+    const int64_t start = esp_timer_get_time();
+#if CONFIG_LVGL_PORT_LOCK_PROFILING
+    /* The mutex is contended, when it cannot be taken right away */
+    bool contended = false;
+    if (xSemaphoreTakeRecursive(lvgl_port_ctx.lvgl_mux, 0) != pdTRUE) {
+        contended = true;
+        if (xSemaphoreTakeRecursive(lvgl_port_ctx.lvgl_mux, timeout_ticks) != pdTRUE) {
+            return false;
+        }
+    }
+#else
+    if (xSemaphoreTakeRecursive(lvgl_port_ctx.lvgl_mux, timeout_ticks) != pdTRUE) {
+        return false;
+    }
+#endif
+
+    /* Mutex is taken, counters can be updated */
+    const uint32_t wait = (uint32_t)(esp_timer_get_time() - start);
+    lvgl_port_ctx.stats.lock_count++;
+    lvgl_port_ctx.stats.lock_wait_us += wait;
+    if (wait > lvgl_port_ctx.stats.lock_wait_max_us) {
+        lvgl_port_ctx.stats.lock_wait_max_us = wait;
+    }
+#if CONFIG_LVGL_PORT_LOCK_PROFILING
+    /* Call site of the lock: caller and its caller (bsp_display_lock and similar wrappers) */
+    void *call_site[2] = {__builtin_return_address(0), NULL};
+#if CONFIG_IDF_TARGET_ARCH_XTENSA
+    if (lvgl_port_ctx.lock_prof.depth == 0) {
+        esp_backtrace_frame_t frame;
+        esp_backtrace_get_start(&frame.pc, &frame.sp, &frame.next_pc);
+        /* Skip this function, the next frame is the caller */
+        for (int i = 0; i < 2 && esp_backtrace_get_next_frame(&frame); i++) {
+            call_site[i] = (void *)ESP_LVGL_PORT_STACK_PC(frame.pc);
+        }
+    }
+#endif
+    lvgl_port_lock_prof_acquired(wait, contended, call_site);
+#endif
+    return true;
 }
 
 void lvgl_port_unlock(void)
 {
     assert(lvgl_port_ctx.lvgl_mux && "lvgl_port_init must be called first");
+#if CONFIG_LVGL_PORT_LOCK_PROFILING
+    lvgl_port_lock_prof_release();
+#endif
     xSemaphoreGiveRecursive(lvgl_port_ctx.lvgl_mux);
 }
 
 esp_err_t lvgl_port_task_wake(lvgl_port_event_type_t event, void *param)
 {
-    if (!lvgl_port_ctx.lvgl_queue) {
+    if (!lvgl_port_ctx.lvgl_task) {
         return ESP_ERR_INVALID_STATE;
     }
 
-    lvgl_port_event_t ev = {
-        .type = event,
-        .param = param,
-    };
+    /* Events are coalesced, one task run handles all of them */
+    uint32_t bits = ESP_LVGL_PORT_NOTIFY_USER;
+    if (event == LVGL_PORT_EVENT_DISPLAY) {
+        bits = ESP_LVGL_PORT_NOTIFY_DISPLAY;
+    } else if (event == LVGL_PORT_EVENT_TOUCH) {
+        lvgl_port_indev_set_pending(param);
+        bits = ESP_LVGL_PORT_NOTIFY_INDEV;
+    }
 
-    if (xPortInIsrContext() == pdTRUE) {
-        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-        xQueueSendFromISR(lvgl_port_ctx.lvgl_queue, &ev, &xHigherPriorityTaskWoken);
-        if (xHigherPriorityTaskWoken) {
-            portYIELD_FROM_ISR( );
-        }
-    } else {
-        xQueueSend(lvgl_port_ctx.lvgl_queue, &ev, 0);
+    if (lvgl_port_task_notify(bits) && xPortInIsrContext() == pdTRUE) {
+        portYIELD_FROM_ISR( );
     }
 
     return ESP_OK;
 }
 
+void lvgl_port_get_thread_cfg(uint32_t index, lvgl_port_thread_cfg_t *cfg)
+{
+    assert(cfg);
+
+    cfg->priority = (lvgl_port_ctx.draw_task_priority > 0 ? lvgl_port_ctx.draw_task_priority : lvgl_port_ctx.task_priority);
+    cfg->stack = lvgl_port_ctx.draw_task_stack;
+    cfg->core = -1;
+    if (configNUM_CORES > 1) {
+        uint32_t mask = ((uint32_t)lvgl_port_ctx.draw_task_affinity & ESP_LVGL_PORT_CORES_MASK);
+        if (mask == 0) {
+            mask = ESP_LVGL_PORT_CORES_MASK;
+        }
+        /* Spread draw tasks over the cores in the mask, the first one on the other core than LVGL task */
+        int core = (lvgl_port_ctx.task_affinity >= 0 ? lvgl_port_ctx.task_affinity + 1 : 0) % configNUM_CORES;
+        uint32_t skip = index % __builtin_popcount(mask);
+        while (!(mask & (1UL << core)) || skip-- > 0) {
+            core = (core + 1) % configNUM_CORES;
+        }
+        cfg->core = core;
+    }
+}
+
 IRAM_ATTR bool lvgl_port_task_notify(uint32_t value)
 {
     BaseType_t need_yield = pdFALSE;
 
     // Notify LVGL task
     if (xPortInIsrContext() == pdTRUE) {
-        xTaskNotifyFromISR(lvgl_port_ctx.lvgl_task, value, eNoAction, &need_yield);
+        xTaskNotifyFromISR(lvgl_port_ctx.lvgl_task, value, eSetBits, &need_yield);
     } else {
-        xTaskNotify(lvgl_port_ctx.lvgl_task, value, eNoAction);
+        xTaskNotify(lvgl_port_ctx.lvgl_task, value, eSetBits);
     }
 
     return (need_yield == pdTRUE);
 }
 
+esp_err_t lvgl_port_get_stats(lvgl_port_stats_t *stats)
+{
+    ESP_RETURN_ON_FALSE(stats, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    lvgl_port_lock(0);
+    memcpy(stats, &lvgl_port_ctx.stats, sizeof(lvgl_port_stats_t));
+    lvgl_port_unlock();
+
+    return ESP_OK;
+}
+
+void lvgl_port_reset_stats(void)
+{
+    lvgl_port_lock(0);
+    memset(&lvgl_port_ctx.stats, 0, sizeof(lvgl_port_stats_t));
+    lvgl_port_unlock();
+}
+
+esp_err_t lvgl_port_get_lock_stats(lvgl_port_lock_stats_t *stats, uint32_t *count)
+{
+#if CONFIG_LVGL_PORT_LOCK_PROFILING
+    ESP_RETURN_ON_FALSE(stats && count, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    lvgl_port_lock(0);
+    const uint32_t cnt = MIN(*count, lvgl_port_ctx.lock_prof.callers_cnt);
+    memcpy(stats, lvgl_port_ctx.lock_prof.callers, cnt * sizeof(lvgl_port_lock_stats_t));
+    lvgl_port_unlock();
+    *count = cnt;
+
+    return ESP_OK;
+#else
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+void lvgl_port_reset_lock_stats(void)
+{
+#if CONFIG_LVGL_PORT_LOCK_PROFILING
+    lvgl_port_lock(0);
+    /* Tasks keep their slots, the current hold is measured from now */
+    lvgl_port_lock_prof_t *prof = &lvgl_port_ctx.lock_prof;
+    for (uint32_t i = 0; i < prof->callers_cnt; i++) {
+        lvgl_port_lock_stats_t *caller = &prof->callers[i];
+        memset(&caller->count, 0, sizeof(lvgl_port_lock_stats_t) - offsetof(lvgl_port_lock_stats_t, count));
+    }
+    prof->hold_start = esp_timer_get_time();
+    lvgl_port_unlock();
+#endif
+}
+
+void lvgl_port_print_lock_stats(void)
+{
+#if CONFIG_LVGL_PORT_LOCK_PROFILING
+    lvgl_port_lock_stats_t stats[ESP_LVGL_PORT_LOCK_CALLERS];
+    uint32_t count = ESP_LVGL_PORT_LOCK_CALLERS;
+    if (lvgl_port_get_lock_stats(stats, &count) != ESP_OK) {
+        return;
+    }
+
+    /* Printed without the mutex, the log doesn't prolong holds of other tasks */
+    ESP_LOGI(TAG, "LVGL mutex profile (histogram buckets: <10us <100us <1ms <10ms <100ms >=100ms)");
+    for (uint32_t i = 0; i < count; i++) {
+        const lvgl_port_lock_stats_t *s = &stats[i];
+        ESP_LOGI(TAG, "%-16s count %"PRIu32", contended %"PRIu32", wait avg %"PRIu32" max %"PRIu32" us, hold avg %"PRIu32" max %"PRIu32" us at %p:%p",
+                 s->task_name, s->count, s->contended,
+                 (uint32_t)(s->count ? s->wait_us / s->count : 0), s->wait_max_us,
+                 (uint32_t)(s->count ? s->hold_us / s->count : 0), s->hold_max_us,
+                 s->hold_max_call_site[0], s->hold_max_call_site[1]);
+        ESP_LOGI(TAG, "%-16s wait %"PRIu32" %"PRIu32" %"PRIu32" %"PRIu32" %"PRIu32" %"PRIu32", hold %"PRIu32" %"PRIu32" %"PRIu32" %"PRIu32" %"PRIu32" %"PRIu32"", "",
+                 s->wait_hist[0], s->wait_hist[1], s->wait_hist[2], s->wait_hist[3], s->wait_hist[4], s->wait_hist[5],
+                 s->hold_hist[0], s->hold_hist[1], s->hold_hist[2], s->hold_hist[3], s->hold_hist[4], s->hold_hist[5]);
+    }
+#endif
+}
+
 /*******************************************************************************
 * Private functions
 *******************************************************************************/
 
 static void lvgl_port_task(void *arg)
 {
-    lvgl_port_event_t event;
+    uint32_t notify = 0;
     uint32_t task_delay_ms = 0;
-    lv_indev_t *indev = NULL;
 
     /* Take the task semaphore */
     if (xSemaphoreTake(lvgl_port_ctx.task_init_mux, 0) != pdTRUE) {
@@ -224,30 +443,38 @@ static void lvgl_port_task(void *arg)
 
     ESP_LOGI(TAG, "Starting LVGL task");
     lvgl_port_ctx.running = true;
+    TickType_t last_sleep = xTaskGetTickCount();
     while (lvgl_port_ctx.running) {
-        /* Wait for queue or timeout (sleep task) */
+        /* Wait for events or timeout (sleep task), all events received in the meantime are handled at once */
         TickType_t wait = (pdMS_TO_TICKS(task_delay_ms) >= 1 ? pdMS_TO_TICKS(task_delay_ms) : 1);
-        xQueueReceive(lvgl_port_ctx.lvgl_queue, &event, wait);
+        const TickType_t wait_start = xTaskGetTickCount();
+        if (xTaskNotifyWait(0, ULONG_MAX, &notify, wait) != pdTRUE || xTaskGetTickCount() != wait_start) {
+            last_sleep = xTaskGetTickCount();
+        } else if (xTaskGetTickCount() - last_sleep >= pdMS_TO_TICKS(ESP_LVGL_PORT_TASK_MAX_BUSY_MS)) {
+            /* Too many events, give time to other tasks and interrupts */
+            vTaskDelay(1);
+            last_sleep = xTaskGetTickCount();
+        }
 
         if (lv_display_get_default() && lvgl_port_lock(0)) {
 
+            /* Displays with own flush task finished their frames */
+            if (notify & ESP_LVGL_PORT_NOTIFY_DISPLAY) {
+                lvgl_port_disp_refr_resume();
+            }
+
             /* Call read input devices */
-            if (event.type == LVGL_PORT_EVENT_TOUCH) {
-                xSemaphoreTake(lvgl_port_ctx.timer_mux, portMAX_DELAY);
-                if (event.param != NULL) {
-                    lv_indev_read(event.param);
-                } else {
-                    indev = lv_indev_get_next(NULL);
-                    while (indev != NULL) {
-                        lv_indev_read(indev);
-                        indev = lv_indev_get_next(indev);
-                    }
-                }
-                xSemaphoreGive(lvgl_port_ctx.timer_mux);
+            if (notify & ESP_LVGL_PORT_NOTIFY_INDEV) {
+                const int64_t read_start = esp_timer_get_time();
+                lvgl_port_indev_read_pending();
+                lvgl_port_ctx.stats.indev_reads++;
+                lvgl_port_ctx.stats.indev_read_us += (esp_timer_get_time() - read_start);
             }
 
             /* Handle LVGL */
+            const int64_t handler_start = esp_timer_get_time();
             task_delay_ms = lv_timer_handler();
+            lvgl_port_ctx.stats.timer_handler_us += (esp_timer_get_time() - handler_start);
             lvgl_port_unlock();
         } else {
             task_delay_ms = 1; /*Keep trying*/
@@ -257,8 +484,12 @@ static void lvgl_port_task(void *arg)
             task_delay_ms = lvgl_port_ctx.task_max_sleep_ms;
         }
 
-        /* Minimal dealy for the task. When there is too much events, it takes time for other tasks and interrupts. */
-        vTaskDelay(1);
+#if CONFIG_LVGL_PORT_LOCK_PROFILING && CONFIG_LVGL_PORT_LOCK_PROFILING_LOG_PERIOD_MS > 0
+        if (esp_timer_get_time() - lvgl_port_ctx.lock_prof.last_log >= CONFIG_LVGL_PORT_LOCK_PROFILING_LOG_PERIOD_MS * 1000LL) {
+            lvgl_port_ctx.lock_prof.last_log = esp_timer_get_time();
+            lvgl_port_print_lock_stats();
+        }
+#endif
     }
 
     /* Give semaphore back */
@@ -279,9 +510,6 @@ static void lvgl_port_task_deinit(void)
     if (lvgl_port_ctx.task_init_mux) {
         vSemaphoreDelete(lvgl_port_ctx.task_init_mux);
     }
-    if (lvgl_port_ctx.lvgl_queue) {
-        vQueueDelete(lvgl_port_ctx.lvgl_queue);
-    }
     memset(&lvgl_port_ctx, 0, sizeof(lvgl_port_ctx));
 #if LV_ENABLE_GC || !LV_MEM_CUSTOM
     /* Deinitialize LVGL */
@@ -289,6 +517,173 @@ static void lvgl_port_task_deinit(void)
 #endif
 }
 
+#if CONFIG_LVGL_PORT_LOCK_PROFILING
+static inline uint32_t lvgl_port_lock_hist_bucket(uint32_t time_us)
+{
+    uint32_t bucket = 0;
+    for (uint32_t limit = 10; bucket < LVGL_PORT_LOCK_HIST_BUCKETS - 1 && time_us >= limit; limit *= 10) {
+        bucket++;
+    }
+    return bucket;
+}
+
+static lvgl_port_lock_stats_t *lvgl_port_lock_prof_caller(lvgl_port_lock_prof_t *prof, TaskHandle_t task)
+{
+    for (uint32_t i = 0; i < prof->callers_cnt; i++) {
+        if (prof->tasks[i] == task) {
+            return &prof->callers[i];
+        }
+    }
+
+    /* The last slot is shared by all the other tasks */
+    if (prof->callers_cnt == ESP_LVGL_PORT_LOCK_CALLERS - 1) {
+        prof->tasks[prof->callers_cnt] = NULL;
+        strlcpy(prof->callers[prof->callers_cnt].task_name, "other", sizeof(prof->callers[0].task_name));
+        prof->callers_cnt++;
+    }
+    if (prof->callers_cnt == ESP_LVGL_PORT_LOCK_CALLERS) {
+        return &prof->callers[ESP_LVGL_PORT_LOCK_CALLERS - 1];
+    }
+
+    lvgl_port_lock_stats_t *caller = &prof->callers[prof->callers_cnt];
+    prof->tasks[prof->callers_cnt] = task;
+    strlcpy(caller->task_name, pcTaskGetName(task), sizeof(caller->task_name));
+    prof->callers_cnt++;
+    return caller;
+}
+
+/* Called with the mutex taken */
+static void lvgl_port_lock_prof_acquired(uint32_t wait, bool contended, void *const call_site[2])
+{
+    lvgl_port_lock_prof_t *prof = &lvgl_port_ctx.lock_prof;
+    if (prof->depth++ > 0) {
+        return;
+    }
+
+    lvgl_port_lock_stats_t *caller = lvgl_port_lock_prof_caller(prof, xTaskGetCurrentTaskHandle());
+    caller->count++;
+    if (contended) {
+        caller->contended++;
+    }
+    caller->wait_us += wait;
+    if (wait > caller->wait_max_us) {
+        caller->wait_max_us = wait;
+    }
+    caller->wait_hist[lvgl_port_lock_hist_bucket(wait)]++;
+
+    prof->holder = caller;
+    prof->call_site[0] = call_site[0];
+    prof->call_site[1] = call_site[1];
+    prof->hold_start = esp_timer_get_time();
+}
+
+/* Called before the mutex is given */
+static void lvgl_port_lock_prof_release(void)
+{
+    lvgl_port_lock_prof_t *prof = &lvgl_port_ctx.lock_prof;
+    if (prof->depth == 0 || --prof->depth > 0) {
+        return;
+    }
+
+    lvgl_port_lock_stats_t *caller = prof->holder;
+    const uint32_t hold = (uint32_t)(esp_timer_get_time() - prof->hold_start);
+    caller->hold_us += hold;
+    if (hold > caller->hold_max_us) {
+        caller->hold_max_us = hold;
+        caller->hold_max_call_site[0] = prof->call_site[0];
+        caller->hold_max_call_site[1] = prof->call_site[1];
+    }
+    caller->hold_hist[lvgl_port_lock_hist_bucket(hold)]++;
+    prof->holder = NULL;
+}
+#endif
+
+/* Mark input device to be read in the next task run (it can be called from ISR) */
+static void lvgl_port_indev_set_pending(lv_indev_t *indev)
+{
+    uint32_t bit = ESP_LVGL_PORT_INDEV_ALL;
+
+    portENTER_CRITICAL_SAFE(&lvgl_port_ctx.indev_lock);
+    if (indev != NULL) {
+        int slot = -1;
+        for (int i = 0; i < ESP_LVGL_PORT_MAX_INDEVS; i++) {
+            if (lvgl_port_ctx.indevs[i] == indev) {
+                slot = i;
+                break;
+            }
+            if (slot < 0 && lvgl_port_ctx.indevs[i] == NULL) {
+                slot = i;
+            }
+        }
+        /* Without free slot, all input devices are read */
+        if (slot >= 0) {
+            lvgl_port_ctx.indevs[slot] = indev;
+            bit = (1UL << slot);
+        }
+    }
+    lvgl_port_ctx.indev_pending |= bit;
+    portEXIT_CRITICAL_SAFE(&lvgl_port_ctx.indev_lock);
+}
+
+static bool lvgl_port_indev_exists(lv_indev_t *indev)
+{
+    lv_indev_t *i = lv_indev_get_next(NULL);
+    while (i != NULL && i != indev) {
+        i = lv_indev_get_next(i);
+    }
+    return (i != NULL);
+}
+
+/* Read all input devices marked by events */
+static void lvgl_port_indev_read_pending(void)
+{
+    lv_indev_t *indevs[ESP_LVGL_PORT_MAX_INDEVS];
+
+    portENTER_CRITICAL(&lvgl_port_ctx.indev_lock);
+    const uint32_t pending = lvgl_port_ctx.indev_pending;
+    lvgl_port_ctx.indev_pending = 0;
+    memcpy(indevs, lvgl_port_ctx.indevs, sizeof(indevs));
+    portEXIT_CRITICAL(&lvgl_port_ctx.indev_lock);
+
+    if (lvgl_port_ctx.timer_mux) {
+        xSemaphoreTake(lvgl_port_ctx.timer_mux, portMAX_DELAY);
+    }
+    if (pending & ESP_LVGL_PORT_INDEV_ALL) {
+        lv_indev_t *indev = lv_indev_get_next(NULL);
+        while (indev != NULL) {
+            lv_indev_read(indev);
+            indev = lv_indev_get_next(indev);
+        }
+    } else {
+        for (int i = 0; i < ESP_LVGL_PORT_MAX_INDEVS; i++) {
+            if (!(pending & (1UL << i))) {
+                continue;
+            }
+            if (lvgl_port_indev_exists(indevs[i])) {
+                lv_indev_read(indevs[i]);
+            } else {
+                /* Input device was removed, free the slot */
+                portENTER_CRITICAL(&lvgl_port_ctx.indev_lock);
+                if (lvgl_port_ctx.indevs[i] == indevs[i]) {
+                    lvgl_port_ctx.indevs[i] = NULL;
+                }
+                portEXIT_CRITICAL(&lvgl_port_ctx.indev_lock);
+            }
+        }
+    }
+    if (lvgl_port_ctx.timer_mux) {
+        xSemaphoreGive(lvgl_port_ctx.timer_mux);
+    }
+}
+
+#if ESP_LVGL_PORT_TICK_CB_SUPPORTED
+static uint32_t lvgl_port_tick_get(void)
+{
+    /* esp_timer keeps counting in light sleep */
+    return (uint32_t)(esp_timer_get_time() / 1000);
+}
+#endif
+
 static void lvgl_port_tick_increment(void *arg)
 {
     xSemaphoreTake(lvgl_port_ctx.timer_mux, portMAX_DELAY);
@@ -299,6 +694,14 @@ static void lvgl_port_tick_increment(void *arg)
 
 static esp_err_t lvgl_port_tick_init(void)
 {
+#if ESP_LVGL_PORT_TICK_CB_SUPPORTED
+    if (lvgl_port_ctx.tickless) {
+        /* LVGL reads the time when it needs it, the CPU is not woken up periodically */
+        lv_tick_set_cb(lvgl_port_tick_get);
+        return ESP_OK;
+    }
+#endif
+
     // Tick interface for LVGL (using esp_timer to generate 2ms periodic event)
     const esp_timer_create_args_t lvgl_tick_timer_args = {
         .callback = &lvgl_port_tick_increment,
@@ -12,11 +12,16 @@
 #include "freertos/task.h"
 #include "freertos/semphr.h"
 #include "esp_heap_caps.h"
+#include "esp_timer.h"
 #include "esp_idf_version.h"
+#include "esp_bit_defs.h"
+#include "soc/soc_caps.h"
 #include "esp_lcd_panel_io.h"
 #include "esp_lcd_panel_ops.h"
 #include "esp_lvgl_port.h"
 #include "esp_lvgl_port_priv.h"
+#include "esp_lvgl_port_rotate.h"
+#include "src/display/lv_display_private.h"
 
 #if CONFIG_IDF_TARGET_ESP32S3 && ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
 #include "esp_lcd_panel_rgb.h"
@@ -26,37 +31,146 @@
 #include "esp_lcd_mipi_dsi.h"
 #endif
 
+/* Sync of the panel framebuffers in direct mode by async memcpy (DMA), LVGL copies the areas by CPU otherwise */
+#if SOC_GDMA_SUPPORTED && ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 2, 0)
+#include "esp_async_memcpy.h"
+#include "esp_cache.h"
+#define LVGL_PORT_FB_SYNC_ASYNC 1
+#else
+#define LVGL_PORT_FB_SYNC_ASYNC 0
+#endif
+
 #if (ESP_IDF_VERSION < ESP_IDF_VERSION_VAL(4, 4, 4)) || (ESP_IDF_VERSION == ESP_IDF_VERSION_VAL(5, 0, 0))
 #define LVGL_PORT_HANDLE_FLUSH_READY 0
 #else
 #define LVGL_PORT_HANDLE_FLUSH_READY 1
 #endif
 
+/* Number of rotation buffers, when the rotation is pipelined with the transfers */
+#define LVGL_PORT_ROT_BUFFS (2)
+
+/* Maximum number of buffers in the shared pool (two draw buffers and two rotation buffers) */
+#define LVGL_PORT_BUFF_POOL_MAX_BUFFS (4)
+
+/* Maximum number of displays using the shared buffer pool */
+#define LVGL_PORT_BUFF_POOL_MAX_DISPS (4)
+
+/* Default cost of one draw_bitmap transaction (commands, window setup, DMA setup) expressed in pixels */
+#define LVGL_PORT_TRANS_OVERHEAD_PX_DEFAULT (64)
+
+/* Window for computing FPS of the display */
+#define LVGL_PORT_STATS_FPS_WINDOW_US (1000 * 1000)
+
+/* LVGL sends events when waiting for the flush since v9.1 */
+#define LVGL_PORT_STATS_FLUSH_WAIT (LVGL_VERSION_MAJOR > 9 || LVGL_VERSION_MINOR >= 1)
+
+/* Default stack size of the display flush task */
+#define LVGL_PORT_FLUSH_TASK_STACK_DEFAULT (4096)
+
+/* Length of the flush task queue (LVGL queues at most one area, while the previous one is processed) */
+#define LVGL_PORT_FLUSH_QUEUE_LEN (2)
+
+/* Alignment of the framebuffer sync copies (covers cache line size of PSRAM on all targets) */
+#define LVGL_PORT_FB_SYNC_ALIGN (128)
+
+/* LVGL private API was renamed in v9.2 */
+#if LVGL_VERSION_MAJOR == 9 && LVGL_VERSION_MINOR < 2
+#define lvgl_port_ll_clear(ll) _lv_ll_clear(ll)
+#else
+#define lvgl_port_ll_clear(ll) lv_ll_clear(ll)
+#endif
+
 static const char *TAG = "LVGL";
 
 /*******************************************************************************
 * Types definitions
 *******************************************************************************/
 
+typedef struct {
+    uint32_t offset;    /* Offset in the framebuffer in bytes */
+    uint32_t size;      /* Size in bytes */
+} lvgl_port_fb_band_t;
+
+/* Everything needed to flush one area, it is taken from LVGL in the flush callback (with LVGL mutex taken) */
+typedef struct {
+    lv_area_t             area;         /* Area to flush */
+    uint8_t               *color_map;   /* Rendered pixels, NULL stops the flush task */
+    bool                  last;         /* Last area of the frame */
+    lv_display_rotation_t rotation;     /* Display rotation */
+    lv_color_format_t     color_format; /* Display color format */
+    int32_t               hres;         /* Horizontal resolution of the display (rotated) */
+    int32_t               vres;         /* Vertical resolution of the display (rotated) */
+} lvgl_port_flush_job_t;
+
 typedef struct {
     lvgl_port_disp_type_t     disp_type;    /* Display type */
     esp_lcd_panel_io_handle_t io_handle;      /* LCD panel IO handle */
     esp_lcd_panel_handle_t    panel_handle;   /* LCD panel handle */
     esp_lcd_panel_handle_t    control_handle; /* LCD panel control handle */
     lvgl_port_rotation_cfg_t  rotation;       /* Default values of the screen rotation */
-    lv_color_t                *draw_buffs[3]; /* Display draw buffers */
+    lv_color_t                *draw_buffs[4]; /* Display draw buffers (0, 1: LVGL buffers, 2, 3: rotation buffers, 2: pages of monochrome display) */
     lv_display_t              *disp_drv;      /* LVGL display driver */
     lv_display_rotation_t     current_rotation;
     SemaphoreHandle_t         trans_sem;      /* Idle transfer mutex */
+    SemaphoreHandle_t         rot_sem;        /* Free rotation buffers (only for pipelined rotation) */
+    uint8_t                   rot_buff_idx;   /* Next rotation buffer to use (only for pipelined rotation) */
+    uint32_t                  draw_buff_size; /* Size of one draw buffer in bytes */
+    uint32_t                  trans_overhead_px; /* Cost of one draw_bitmap transaction in pixels (for merging areas) */
+    uint8_t                   *fbs[3];        /* Panel framebuffers (only triple buffering) */
+    portMUX_TYPE              fbs_lock;       /* Lock of the framebuffers state, shared with vsync ISR */
+    uint8_t                   fb_shown;       /* Mask of the framebuffers, which can be displayed (two, if vsync came while giving one) */
+    int8_t                    fb_given;       /* Index of the last framebuffer given to the panel driver */
+    int8_t                    fb_giving;      /* Index of the framebuffer being given to the panel driver, -1 if none */
+    bool                      fb_vsync;       /* Vsync came after fb_given was given (the frame was not dropped) */
+    bool                      fb_wait;        /* Flush waits for vsync in trans_sem, no framebuffer is free */
+    portMUX_TYPE              stats_lock;     /* Lock of the performance counters, updated also by the flush task */
+    lvgl_port_disp_stats_t    stats;          /* Performance counters (protected by stats_lock) */
+    int64_t                   stats_frame_start; /* Start of the current frame in us */
+    int64_t                   stats_wait_start;  /* Start of LVGL waiting for the flush in us */
+    uint32_t                  stats_frame_busy;  /* Time of flushing in the current frame in us */
+    int64_t                   stats_fps_start;   /* Start of the FPS window in us */
+    uint32_t                  stats_fps_frames;  /* Frames in the FPS window */
+    uint8_t                   pool_next;      /* Next buffer leased from the shared pool */
+    TaskHandle_t              flush_task;     /* Task flushing the areas (only with own flush task) */
+    QueueHandle_t             flush_queue;    /* Areas to be flushed by the flush task */
+    SemaphoreHandle_t         flush_done_sem; /* Given on every flush ready, LVGL waits on it instead of spinning */
+    SemaphoreHandle_t         flush_exit_sem; /* Given, when the flush task exits */
+    volatile uint32_t         flush_done_cnt; /* Number of finished flushes (flush ready) */
+    volatile bool             refr_resume;    /* Last frame is flushed, LVGL can resume the refresh timer */
+#if LVGL_PORT_FB_SYNC_ASYNC
+    async_memcpy_handle_t     sync_mcp;       /* Async memcpy for the framebuffers sync (only direct mode with avoid tearing) */
+    SemaphoreHandle_t         sync_sem;       /* Finished framebuffers sync copies */
+    uint8_t                   *sync_fbs[2];   /* Panel framebuffers */
+    uint8_t                   *sync_dst;      /* Framebuffer, where the rendered areas are copied */
+    uint32_t                  sync_fb_size;   /* Size of one panel framebuffer in bytes */
+    lvgl_port_fb_band_t       sync_bands[LV_INV_BUF_SIZE]; /* Row bands being copied */
+    uint32_t                  sync_bands_cnt;
+    uint32_t                  sync_pending;   /* Number of unfinished async copies */
+#endif
     struct {
         unsigned int monochrome: 1;  /* True, if display is monochrome and using 1bit for 1px */
         unsigned int swap_bytes: 1;  /* Swap bytes in RGB656 (16-bit) before send to LCD driver */
+        unsigned int triple_buffer: 1; /* Three panel framebuffers rotated as render/pending/scanout */
         unsigned int full_refresh: 1;   /* Always make the whole screen redrawn */
         unsigned int direct_mode: 1;    /* Use screen-sized buffers and draw to absolute coordinates */
         unsigned int sw_rotate: 1;    /* Use software rotation (slower) or PPA if available */
+        unsigned int merge_areas: 1;  /* Merge invalidated areas before rendering */
+        unsigned int buff_pool: 1;    /* Draw and rotation buffers are leased from the shared pool */
     } flags;
 } lvgl_port_display_ctx_t;
 
+typedef struct {
+    uint8_t                   *buffs[LVGL_PORT_BUFF_POOL_MAX_BUFFS];  /* Shared buffers */
+    uint32_t                  buff_count;     /* Number of buffers, 0 if the pool is not created */
+    size_t                    buff_size;      /* Size of one buffer in bytes */
+    lvgl_port_display_ctx_t   *disps[LVGL_PORT_BUFF_POOL_MAX_DISPS];  /* Displays using the pool */
+} lvgl_port_buff_pool_t;
+
+/*******************************************************************************
+* Local variables
+*******************************************************************************/
+static lvgl_port_buff_pool_t lvgl_port_buff_pool;
+
 /*******************************************************************************
 * Function definitions
 *******************************************************************************/
@@ -72,9 +186,34 @@ static bool lvgl_port_flush_dpi_vsync_ready_callback(esp_lcd_panel_handle_t pane
 #endif
 #endif
 static void lvgl_port_flush_callback(lv_display_t *drv, const lv_area_t *area, uint8_t *color_map);
+static void lvgl_port_flush_area(lvgl_port_display_ctx_t *disp_ctx, lvgl_port_flush_job_t *job);
+static bool lvgl_port_disp_flush_ready(lvgl_port_display_ctx_t *disp_ctx);
+static void lvgl_port_flush_wait(lvgl_port_display_ctx_t *disp_ctx);
+static void lvgl_port_flush_wait_callback(lv_display_t *disp);
+static esp_err_t lvgl_port_flush_task_init(lvgl_port_display_ctx_t *disp_ctx, const lvgl_port_display_cfg_t *disp_cfg);
+static void lvgl_port_flush_task_deinit(lvgl_port_display_ctx_t *disp_ctx);
+static void lvgl_port_rotate_area_res(lv_area_t *area, lv_display_rotation_t rotation, int32_t hres, int32_t vres);
+static void lvgl_port_rotate_buffer(lv_color_format_t cf, const lv_area_t *area, const uint8_t *src, uint8_t *dst, lv_display_rotation_t rotation, bool swap_bytes);
 static void lvgl_port_disp_size_update_callback(lv_event_t *e);
 static void lvgl_port_disp_rotation_update(lvgl_port_display_ctx_t *disp_ctx);
 static void lvgl_port_display_invalidate_callback(lv_event_t *e);
+static void lvgl_port_display_refr_start_callback(lv_event_t *e);
+static void lvgl_port_fb_queue(lvgl_port_display_ctx_t *disp_ctx, uint8_t *fb);
+static void lvgl_port_fb_vsync_isr(lvgl_port_display_ctx_t *disp_ctx, BaseType_t *need_yield);
+static void lvgl_port_stats_frame_done(lvgl_port_display_ctx_t *disp_ctx, int64_t now);
+static void *lvgl_port_buff_alloc(lvgl_port_display_ctx_t *disp_ctx, size_t size, uint32_t caps);
+static void lvgl_port_buff_free(void *buff);
+static esp_err_t lvgl_port_buff_pool_attach(lvgl_port_display_ctx_t *disp_ctx);
+static void lvgl_port_buff_pool_detach(lvgl_port_display_ctx_t *disp_ctx);
+static void lvgl_port_buff_pool_wait(lvgl_port_display_ctx_t *disp_ctx);
+#if LVGL_PORT_STATS_FLUSH_WAIT
+static void lvgl_port_display_flush_wait_callback(lv_event_t *e);
+#endif
+#if LVGL_PORT_FB_SYNC_ASYNC
+static void lvgl_port_fb_sync_start(lvgl_port_display_ctx_t *disp_ctx, uint8_t *front);
+static void lvgl_port_fb_sync_wait(lvgl_port_display_ctx_t *disp_ctx);
+static void lvgl_port_fb_sync_deinit(lvgl_port_display_ctx_t *disp_ctx);
+#endif
 
 /*******************************************************************************
 * Public API functions
@@ -82,8 +221,13 @@ static void lvgl_port_display_invalidate_callback(lv_event_t *e);
 
 lv_display_t *lvgl_port_add_disp(const lvgl_port_display_cfg_t *disp_cfg)
 {
+    const lvgl_port_disp_priv_cfg_t priv_cfg = {
+#if LVGL_PORT_HANDLE_FLUSH_READY
+        .pipelined_rotation = disp_cfg->flags.pipelined_rotation,
+#endif
+    };
     lvgl_port_lock(0);
-    lv_disp_t *disp = lvgl_port_add_disp_priv(disp_cfg, NULL);
+    lv_disp_t *disp = lvgl_port_add_disp_priv(disp_cfg, &priv_cfg);
 
     if (disp != NULL) {
         lvgl_port_display_ctx_t *disp_ctx = (lvgl_port_display_ctx_t *)lv_display_get_user_data(disp);
@@ -113,6 +257,7 @@ lv_display_t *lvgl_port_add_disp_dsi(const lvgl_port_display_cfg_t *disp_cfg, co
     assert(dsi_cfg != NULL);
     const lvgl_port_disp_priv_cfg_t priv_cfg = {
         .avoid_tearing = dsi_cfg->flags.avoid_tearing,
+        .triple_buffer = dsi_cfg->flags.triple_buffer,
     };
     lvgl_port_lock(0);
     lv_disp_t *disp = lvgl_port_add_disp_priv(disp_cfg, &priv_cfg);
@@ -149,6 +294,7 @@ lv_display_t *lvgl_port_add_disp_rgb(const lvgl_port_display_cfg_t *disp_cfg, co
     assert(rgb_cfg != NULL);
     const lvgl_port_disp_priv_cfg_t priv_cfg = {
         .avoid_tearing = rgb_cfg->flags.avoid_tearing,
+        .triple_buffer = rgb_cfg->flags.triple_buffer,
     };
     lv_disp_t *disp = lvgl_port_add_disp_priv(disp_cfg, &priv_cfg);
 
@@ -170,9 +316,9 @@ lv_display_t *lvgl_port_add_disp_rgb(const lvgl_port_display_cfg_t *disp_cfg, co
         };
 
         if (rgb_cfg->flags.bb_mode && (ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 1, 2))) {
-            ESP_ERROR_CHECK(esp_lcd_rgb_panel_register_event_callbacks(disp_ctx->panel_handle, &bb_cbs, &disp_ctx->disp_drv));
+            ESP_ERROR_CHECK(esp_lcd_rgb_panel_register_event_callbacks(disp_ctx->panel_handle, &bb_cbs, disp));
         } else {
-            ESP_ERROR_CHECK(esp_lcd_rgb_panel_register_event_callbacks(disp_ctx->panel_handle, &vsync_cbs, &disp_ctx->disp_drv));
+            ESP_ERROR_CHECK(esp_lcd_rgb_panel_register_event_callbacks(disp_ctx->panel_handle, &vsync_cbs, disp));
         }
 #else
         ESP_RETURN_ON_FALSE(false, NULL, TAG, "RGB is supported only on ESP32S3 and from IDF 5.0!");
@@ -192,34 +338,140 @@ esp_err_t lvgl_port_remove_disp(lv_display_t *disp)
     lvgl_port_display_ctx_t *disp_ctx = (lvgl_port_display_ctx_t *)lv_display_get_user_data(disp);
 
     lvgl_port_lock(0);
+    if (disp_ctx->flush_task) {
+        /* LVGL doesn't render now, the flush task finishes the queued areas */
+        lvgl_port_flush_wait(disp_ctx);
+    }
     lv_disp_remove(disp);
+    lvgl_port_buff_pool_detach(disp_ctx);
     lvgl_port_unlock();
 
-    if (disp_ctx->draw_buffs[0]) {
-        free(disp_ctx->draw_buffs[0]);
-    }
+    lvgl_port_flush_task_deinit(disp_ctx);
 
-    if (disp_ctx->draw_buffs[1]) {
-        free(disp_ctx->draw_buffs[1]);
+    if (disp_ctx->rot_sem) {
+        /* Wait for transfers from rotation buffers */
+        for (int i = 0; i < LVGL_PORT_ROT_BUFFS; i++) {
+            xSemaphoreTake(disp_ctx->rot_sem, pdMS_TO_TICKS(1000));
+        }
+        vSemaphoreDelete(disp_ctx->rot_sem);
     }
 
-    if (disp_ctx->draw_buffs[2]) {
-        free(disp_ctx->draw_buffs[2]);
+#if LVGL_PORT_FB_SYNC_ASYNC
+    lvgl_port_fb_sync_deinit(disp_ctx);
+#endif
+
+    for (int i = 0; i < 4; i++) {
+        lvgl_port_buff_free(disp_ctx->draw_buffs[i]);
     }
 
     if (disp_ctx->trans_sem) {
         vSemaphoreDelete(disp_ctx->trans_sem);
     }
 
+    if (disp_ctx->flush_done_sem) {
+        vSemaphoreDelete(disp_ctx->flush_done_sem);
+    }
+
     free(disp_ctx);
 
     return ESP_OK;
 }
 
+esp_err_t lvgl_port_buff_pool_init(const lvgl_port_buff_pool_cfg_t *cfg)
+{
+    esp_err_t ret = ESP_OK;
+    ESP_RETURN_ON_FALSE(cfg && cfg->buff_size > 0 && cfg->buff_count > 0, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    ESP_RETURN_ON_FALSE(cfg->buff_count <= LVGL_PORT_BUFF_POOL_MAX_BUFFS, ESP_ERR_INVALID_ARG, TAG, "Maximum number of buffers in the pool is %d", LVGL_PORT_BUFF_POOL_MAX_BUFFS);
+    ESP_RETURN_ON_FALSE(lvgl_port_buff_pool.buff_count == 0, ESP_ERR_INVALID_STATE, TAG, "Buffer pool already exists");
+
+    const uint32_t caps = (cfg->caps ? cfg->caps : MALLOC_CAP_DEFAULT);
+    for (uint32_t i = 0; i < cfg->buff_count; i++) {
+        lvgl_port_buff_pool.buffs[i] = heap_caps_malloc(cfg->buff_size, caps);
+        ESP_GOTO_ON_FALSE(lvgl_port_buff_pool.buffs[i], ESP_ERR_NO_MEM, err, TAG, "Not enough memory for buffer pool allocation!");
+    }
+    lvgl_port_buff_pool.buff_size = cfg->buff_size;
+    lvgl_port_buff_pool.buff_count = cfg->buff_count;
+
+err:
+    if (ret != ESP_OK) {
+        for (uint32_t i = 0; i < cfg->buff_count; i++) {
+            free(lvgl_port_buff_pool.buffs[i]);
+        }
+        memset(&lvgl_port_buff_pool, 0, sizeof(lvgl_port_buff_pool));
+    }
+
+    return ret;
+}
+
+esp_err_t lvgl_port_buff_pool_deinit(void)
+{
+    for (int i = 0; i < LVGL_PORT_BUFF_POOL_MAX_DISPS; i++) {
+        ESP_RETURN_ON_FALSE(lvgl_port_buff_pool.disps[i] == NULL, ESP_ERR_INVALID_STATE, TAG, "Buffer pool is used by display");
+    }
+
+    for (uint32_t i = 0; i < lvgl_port_buff_pool.buff_count; i++) {
+        free(lvgl_port_buff_pool.buffs[i]);
+    }
+    memset(&lvgl_port_buff_pool, 0, sizeof(lvgl_port_buff_pool));
+
+    return ESP_OK;
+}
+
+esp_err_t lvgl_port_get_disp_stats(lv_display_t *disp, lvgl_port_disp_stats_t *stats)
+{
+    ESP_RETURN_ON_FALSE(disp && stats, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    lvgl_port_display_ctx_t *disp_ctx = (lvgl_port_display_ctx_t *)lv_display_get_user_data(disp);
+    ESP_RETURN_ON_FALSE(disp_ctx, ESP_ERR_INVALID_ARG, TAG, "Display was not added by LVGL port");
+
+    portENTER_CRITICAL(&disp_ctx->stats_lock);
+    memcpy(stats, &disp_ctx->stats, sizeof(lvgl_port_disp_stats_t));
+    const int64_t fps_start = disp_ctx->stats_fps_start;
+    portEXIT_CRITICAL(&disp_ctx->stats_lock);
+    /* No frame for the whole window, the display is idle */
+    if (esp_timer_get_time() - fps_start >= 2 * LVGL_PORT_STATS_FPS_WINDOW_US) {
+        stats->fps = 0;
+    }
+
+    return ESP_OK;
+}
+
+void lvgl_port_reset_disp_stats(lv_display_t *disp)
+{
+    assert(disp);
+    lvgl_port_display_ctx_t *disp_ctx = (lvgl_port_display_ctx_t *)lv_display_get_user_data(disp);
+    assert(disp_ctx);
+
+    const int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&disp_ctx->stats_lock);
+    memset(&disp_ctx->stats, 0, sizeof(lvgl_port_disp_stats_t));
+    disp_ctx->stats_fps_start = now;
+    disp_ctx->stats_fps_frames = 0;
+    portEXIT_CRITICAL(&disp_ctx->stats_lock);
+}
+
 void lvgl_port_flush_ready(lv_display_t *disp)
 {
     assert(disp);
-    lv_disp_flush_ready(disp);
+    lvgl_port_display_ctx_t *disp_ctx = (lvgl_port_display_ctx_t *)lv_display_get_user_data(disp);
+    if (disp_ctx) {
+        lvgl_port_disp_flush_ready(disp_ctx);
+    } else {
+        lv_disp_flush_ready(disp);
+    }
+}
+
+void lvgl_port_disp_refr_resume(void)
+{
+    lv_display_t *disp = lv_display_get_next(NULL);
+    while (disp != NULL) {
+        lvgl_port_display_ctx_t *disp_ctx = (lvgl_port_display_ctx_t *)lv_display_get_user_data(disp);
+        /* Only displays added by LVGL port */
+        if (disp->flush_cb == lvgl_port_flush_callback && disp_ctx && disp_ctx->refr_resume) {
+            disp_ctx->refr_resume = false;
+            lv_timer_resume(lv_display_get_refr_timer(disp));
+        }
+        disp = lv_display_get_next(disp);
+    }
 }
 
 /*******************************************************************************
@@ -269,6 +521,11 @@ static lv_display_t *lvgl_port_add_disp_priv(const lvgl_port_display_cfg_t *disp
     disp_ctx->flags.swap_bytes = disp_cfg->flags.swap_bytes;
     disp_ctx->flags.sw_rotate = disp_cfg->flags.sw_rotate;
     disp_ctx->current_rotation = LV_DISPLAY_ROTATION_0;
+    portMUX_INITIALIZE(&disp_ctx->stats_lock);
+
+    /* Waiting for the flush of the display (own flush task, buffer pool) blocks on this semaphore */
+    disp_ctx->flush_done_sem = xSemaphoreCreateBinary();
+    ESP_GOTO_ON_FALSE(disp_ctx->flush_done_sem, ESP_ERR_NO_MEM, err, TAG, "Failed to create flush done Semaphore");
 
     uint32_t buff_caps = 0;
 #if SOC_PSRAM_DMA_CAPABLE == 0
@@ -288,24 +545,78 @@ static lv_display_t *lvgl_port_add_disp_priv(const lvgl_port_display_cfg_t *disp
 
     /* Use RGB internal buffers for avoid tearing effect */
     if (priv_cfg && priv_cfg->avoid_tearing) {
+        void *buf3 = NULL;
+        /* LVGL must not render into the framebuffer, until the panel switches to the other one */
+        ESP_GOTO_ON_FALSE(disp_cfg->flush_task_priority == 0, ESP_ERR_INVALID_ARG, err, TAG, "Flush task cannot be used with avoid tearing!");
+        if (priv_cfg->triple_buffer) {
+            /* Framebuffer waiting for vsync can be replaced only by a whole new frame */
+            ESP_GOTO_ON_FALSE(disp_cfg->flags.full_refresh && !disp_cfg->flags.direct_mode, ESP_ERR_INVALID_ARG, err, TAG, "Triple buffer can be used only with full_refresh!");
+        }
 #if CONFIG_IDF_TARGET_ESP32S3 && ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
         buffer_size = disp_cfg->hres * disp_cfg->vres;
-        ESP_GOTO_ON_ERROR(esp_lcd_rgb_panel_get_frame_buffer(disp_cfg->panel_handle, 2, (void *)&buf1, (void *)&buf2), err, TAG, "Get RGB buffers failed");
+        if (priv_cfg->triple_buffer) {
+            ESP_GOTO_ON_ERROR(esp_lcd_rgb_panel_get_frame_buffer(disp_cfg->panel_handle, 3, (void *)&buf1, (void *)&buf2, &buf3), err, TAG, "Get RGB buffers failed");
+        } else {
+            ESP_GOTO_ON_ERROR(esp_lcd_rgb_panel_get_frame_buffer(disp_cfg->panel_handle, 2, (void *)&buf1, (void *)&buf2), err, TAG, "Get RGB buffers failed");
+        }
 #elif CONFIG_IDF_TARGET_ESP32P4 && ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0)
         buffer_size = disp_cfg->hres * disp_cfg->vres;
-        ESP_GOTO_ON_ERROR(esp_lcd_dpi_panel_get_frame_buffer(disp_cfg->panel_handle, 2, (void *)&buf1, (void *)&buf2), err, TAG, "Get RGB buffers failed");
+        if (priv_cfg->triple_buffer) {
+            ESP_GOTO_ON_ERROR(esp_lcd_dpi_panel_get_frame_buffer(disp_cfg->panel_handle, 3, (void *)&buf1, (void *)&buf2, &buf3), err, TAG, "Get RGB buffers failed");
+        } else {
+            ESP_GOTO_ON_ERROR(esp_lcd_dpi_panel_get_frame_buffer(disp_cfg->panel_handle, 2, (void *)&buf1, (void *)&buf2), err, TAG, "Get RGB buffers failed");
+        }
 #endif
 
+        if (priv_cfg->triple_buffer) {
+            /* Panel displays the first framebuffer after init, LVGL renders into the other two */
+            disp_ctx->flags.triple_buffer = 1;
+            disp_ctx->fbs[0] = (uint8_t *)buf1;
+            disp_ctx->fbs[1] = (uint8_t *)buf2;
+            disp_ctx->fbs[2] = (uint8_t *)buf3;
+            disp_ctx->fb_shown = BIT(0);
+            disp_ctx->fb_given = 0;
+            disp_ctx->fb_giving = -1;
+            disp_ctx->fb_vsync = true;
+            portMUX_INITIALIZE(&disp_ctx->fbs_lock);
+            buf1 = (lv_color_t *)disp_ctx->fbs[1];
+            buf2 = (lv_color_t *)disp_ctx->fbs[2];
+        }
+
         trans_sem = xSemaphoreCreateCounting(1, 0);
         ESP_GOTO_ON_FALSE(trans_sem, ESP_ERR_NO_MEM, err, TAG, "Failed to create transport counting Semaphore");
         disp_ctx->trans_sem = trans_sem;
+
+#if LVGL_PORT_FB_SYNC_ASYNC
+        /* Copy rendered areas into the other framebuffer by DMA after the swap */
+        if (disp_cfg->flags.direct_mode && buf1 && buf2) {
+            async_memcpy_config_t mcp_cfg = ASYNC_MEMCPY_DEFAULT_CONFIG();
+            mcp_cfg.backlog = LV_INV_BUF_SIZE;
+            if (esp_async_memcpy_install(&mcp_cfg, &disp_ctx->sync_mcp) == ESP_OK) {
+                disp_ctx->sync_sem = xSemaphoreCreateCounting(LV_INV_BUF_SIZE, 0);
+                ESP_GOTO_ON_FALSE(disp_ctx->sync_sem, ESP_ERR_NO_MEM, err, TAG, "Failed to create framebuffers sync counting Semaphore");
+                disp_ctx->sync_fbs[0] = (uint8_t *)buf1;
+                disp_ctx->sync_fbs[1] = (uint8_t *)buf2;
+                disp_ctx->sync_fb_size = buffer_size * lv_color_format_get_size(display_color_format);
+            } else {
+                disp_ctx->sync_mcp = NULL;
+                ESP_LOGW(TAG, "Async memcpy is not available, framebuffers will be synchronized by CPU");
+            }
+        }
+#endif
     } else {
+        if (disp_cfg->flags.buff_pool) {
+            /* Draw and rotation buffers are leased from the shared pool, content is not kept between frames */
+            ESP_GOTO_ON_FALSE(!disp_cfg->flags.direct_mode, ESP_ERR_INVALID_ARG, err, TAG, "Buffer pool cannot be used in direct mode!");
+            ESP_GOTO_ON_ERROR(lvgl_port_buff_pool_attach(disp_ctx), err, TAG, "Attach to buffer pool failed");
+        }
+
         /* alloc draw buffers used by LVGL */
         /* it's recommended to choose the size of the draw buffer(s) to be at least 1/10 screen sized */
-        buf1 = heap_caps_malloc(buffer_size * sizeof(lv_color_t), buff_caps);
+        buf1 = lvgl_port_buff_alloc(disp_ctx, buffer_size * sizeof(lv_color_t), buff_caps);
         ESP_GOTO_ON_FALSE(buf1, ESP_ERR_NO_MEM, err, TAG, "Not enough memory for LVGL buffer (buf1) allocation!");
         if (disp_cfg->double_buffer) {
-            buf2 = heap_caps_malloc(buffer_size * sizeof(lv_color_t), buff_caps);
+            buf2 = lvgl_port_buff_alloc(disp_ctx, buffer_size * sizeof(lv_color_t), buff_caps);
             ESP_GOTO_ON_FALSE(buf2, ESP_ERR_NO_MEM, err, TAG, "Not enough memory for LVGL buffer (buf2) allocation!");
         }
 
@@ -317,11 +628,18 @@ static lv_display_t *lvgl_port_add_disp_priv(const lvgl_port_display_cfg_t *disp
 
     /* Monochrome display settings */
     if (disp_cfg->monochrome) {
-        /* When using monochromatic display, there must be used full bufer! */
-        ESP_GOTO_ON_FALSE((disp_cfg->hres * disp_cfg->vres == buffer_size), ESP_ERR_INVALID_ARG, err, TAG, "Monochromatic display must using full buffer!");
+        /* Monochromatic display is written by pages of 8 rows, LVGL renders in RGB565 and the port packs the pixels */
+        ESP_GOTO_ON_FALSE((disp_cfg->vres % 8 == 0), ESP_ERR_INVALID_ARG, err, TAG, "Monochromatic display vertical resolution must be multiple of 8!");
+        ESP_GOTO_ON_FALSE((display_color_format == LV_COLOR_FORMAT_RGB565), ESP_ERR_INVALID_ARG, err, TAG, "Monochromatic display must use RGB565 color format!");
 
         disp_ctx->flags.monochrome = 1;
-        lv_display_set_buffers(disp, buf1, buf2, buffer_size * sizeof(lv_color_t), LV_DISPLAY_RENDER_MODE_FULL);
+        if (disp_cfg->flags.full_refresh) {
+            /* When using full_refresh, there must be used full bufer! */
+            ESP_GOTO_ON_FALSE((disp_cfg->hres * disp_cfg->vres == buffer_size), ESP_ERR_INVALID_ARG, err, TAG, "Full refresh must using full buffer!");
+            lv_display_set_buffers(disp, buf1, buf2, buffer_size * sizeof(lv_color_t), LV_DISPLAY_RENDER_MODE_FULL);
+        } else {
+            lv_display_set_buffers(disp, buf1, buf2, buffer_size * sizeof(lv_color_t), LV_DISPLAY_RENDER_MODE_PARTIAL);
+        }
     } else if (disp_cfg->flags.direct_mode) {
         /* When using direct_mode, there must be used full bufer! */
         ESP_GOTO_ON_FALSE((disp_cfg->hres * disp_cfg->vres == buffer_size), ESP_ERR_INVALID_ARG, err, TAG, "Direct mode must using full buffer!");
@@ -346,26 +664,75 @@ static lv_display_t *lvgl_port_add_disp_priv(const lvgl_port_display_cfg_t *disp
 
     lv_display_set_user_data(disp, disp_ctx);
     disp_ctx->disp_drv = disp;
+    disp_ctx->draw_buff_size = buffer_size * sizeof(lv_color_t);
+
+    /* Merge invalidated areas (not needed, when the whole screen is always redrawn) */
+    if (disp_cfg->flags.merge_areas && !disp_ctx->flags.full_refresh && !disp_ctx->flags.monochrome) {
+        disp_ctx->flags.merge_areas = 1;
+        disp_ctx->trans_overhead_px = (disp_cfg->trans_overhead_px ? disp_cfg->trans_overhead_px : LVGL_PORT_TRANS_OVERHEAD_PX_DEFAULT);
+    }
+    lv_display_add_event_cb(disp, lvgl_port_display_refr_start_callback, LV_EVENT_REFR_START, disp_ctx);
+#if LVGL_PORT_STATS_FLUSH_WAIT
+    lv_display_add_event_cb(disp, lvgl_port_display_flush_wait_callback, LV_EVENT_FLUSH_WAIT_START, disp_ctx);
+    lv_display_add_event_cb(disp, lvgl_port_display_flush_wait_callback, LV_EVENT_FLUSH_WAIT_FINISH, disp_ctx);
+#endif
+    disp_ctx->stats_fps_start = esp_timer_get_time();
+
+    /* Buffer for pixels packed into pages (rotation is done during packing) */
+    if (disp_ctx->flags.monochrome) {
+        const size_t pages_size = (buffer_size * sizeof(lv_color_t) / lv_color_format_get_size(display_color_format) + 7) / 8;
+        disp_ctx->draw_buffs[2] = heap_caps_malloc(pages_size, buff_caps);
+        ESP_GOTO_ON_FALSE(disp_ctx->draw_buffs[2], ESP_ERR_NO_MEM, err, TAG, "Not enough memory for monochrome pages buffer allocation!");
+    }
 
     /* Use SW rotation */
-    if (disp_cfg->flags.sw_rotate) {
-        disp_ctx->draw_buffs[2] = heap_caps_malloc(buffer_size * sizeof(lv_color_t), buff_caps);
+    if (disp_cfg->flags.sw_rotate && !disp_ctx->flags.monochrome) {
+        disp_ctx->draw_buffs[2] = lvgl_port_buff_alloc(disp_ctx, buffer_size * sizeof(lv_color_t), buff_caps);
         ESP_GOTO_ON_FALSE(disp_ctx->draw_buffs[2], ESP_ERR_NO_MEM, err, TAG, "Not enough memory for LVGL buffer (rotation buffer) allocation!");
+
+        /* Second rotation buffer: next area can be rotated, while the previous one is transferred */
+        if (priv_cfg && priv_cfg->pipelined_rotation) {
+            disp_ctx->draw_buffs[3] = lvgl_port_buff_alloc(disp_ctx, buffer_size * sizeof(lv_color_t), buff_caps);
+            if (disp_ctx->draw_buffs[3]) {
+                disp_ctx->rot_sem = xSemaphoreCreateCounting(LVGL_PORT_ROT_BUFFS, LVGL_PORT_ROT_BUFFS);
+                ESP_GOTO_ON_FALSE(disp_ctx->rot_sem, ESP_ERR_NO_MEM, err, TAG, "Failed to create rotation buffers counting Semaphore");
+            } else {
+                /* Not pipelined, one rotation buffer is enough */
+                ESP_LOGW(TAG, "Not enough memory for second rotation buffer, rotation is not pipelined");
+            }
+        }
+    }
+
+    /* Own flush task, LVGL task doesn't wait for the panel */
+    if (disp_cfg->flush_task_priority > 0) {
+        ESP_GOTO_ON_ERROR(lvgl_port_flush_task_init(disp_ctx, disp_cfg), err, TAG, "Create flush task failed");
+        lv_display_set_flush_wait_cb(disp, lvgl_port_flush_wait_callback);
     }
 
 
 err:
     if (ret != ESP_OK) {
-        if (buf1) {
-            free(buf1);
-        }
-        if (buf2) {
-            free(buf2);
-        }
-        if (disp_ctx->draw_buffs[2]) {
-            free(disp_ctx->draw_buffs[2]);
+        /* Display must not be used with the freed context */
+        if (disp) {
+            lv_display_delete(disp);
+            disp = NULL;
         }
+        lvgl_port_buff_free(buf1);
+        lvgl_port_buff_free(buf2);
         if (disp_ctx) {
+            lvgl_port_buff_free(disp_ctx->draw_buffs[2]);
+            lvgl_port_buff_free(disp_ctx->draw_buffs[3]);
+            lvgl_port_buff_pool_detach(disp_ctx);
+            lvgl_port_flush_task_deinit(disp_ctx);
+            if (disp_ctx->rot_sem) {
+                vSemaphoreDelete(disp_ctx->rot_sem);
+            }
+            if (disp_ctx->flush_done_sem) {
+                vSemaphoreDelete(disp_ctx->flush_done_sem);
+            }
+#if LVGL_PORT_FB_SYNC_ASYNC
+            lvgl_port_fb_sync_deinit(disp_ctx);
+#endif
             free(disp_ctx);
         }
         if (trans_sem) {
@@ -379,10 +746,22 @@ err:
 #if LVGL_PORT_HANDLE_FLUSH_READY
 static bool lvgl_port_flush_io_ready_callback(esp_lcd_panel_io_handle_t panel_io, esp_lcd_panel_io_event_data_t *edata, void *user_ctx)
 {
+    BaseType_t need_yield = pdFALSE;
+
     lv_display_t *disp_drv = (lv_display_t *)user_ctx;
     assert(disp_drv != NULL);
-    lv_disp_flush_ready(disp_drv);
-    return false;
+    lvgl_port_display_ctx_t *disp_ctx = (lvgl_port_display_ctx_t *)lv_display_get_user_data(disp_drv);
+
+    /* Transfers are done in order. While any rotation buffer is taken, the finished transfer was sent from rotation buffer
+     * (LVGL buffer was released right after rotation). Otherwise it was sent directly from LVGL buffer. */
+    if (disp_ctx && disp_ctx->rot_sem && uxSemaphoreGetCountFromISR(disp_ctx->rot_sem) < LVGL_PORT_ROT_BUFFS) {
+        xSemaphoreGiveFromISR(disp_ctx->rot_sem, &need_yield);
+    } else if (disp_ctx) {
+        return lvgl_port_disp_flush_ready(disp_ctx);
+    } else {
+        lv_disp_flush_ready(disp_drv);
+    }
+    return (need_yield == pdTRUE);
 }
 
 #if (CONFIG_IDF_TARGET_ESP32P4 && ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0))
@@ -390,8 +769,9 @@ static bool lvgl_port_flush_dpi_panel_ready_callback(esp_lcd_panel_handle_t pane
 {
     lv_display_t *disp_drv = (lv_display_t *)user_ctx;
     assert(disp_drv != NULL);
-    lv_disp_flush_ready(disp_drv);
-    return false;
+    lvgl_port_display_ctx_t *disp_ctx = (lvgl_port_display_ctx_t *)lv_display_get_user_data(disp_drv);
+    assert(disp_ctx != NULL);
+    return lvgl_port_disp_flush_ready(disp_ctx);
 }
 
 static bool lvgl_port_flush_dpi_vsync_ready_callback(esp_lcd_panel_handle_t panel_io, esp_lcd_dpi_panel_event_data_t *edata, void *user_ctx)
@@ -403,7 +783,9 @@ static bool lvgl_port_flush_dpi_vsync_ready_callback(esp_lcd_panel_handle_t pane
     lvgl_port_display_ctx_t *disp_ctx = (lvgl_port_display_ctx_t *)lv_display_get_user_data(disp_drv);
     assert(disp_ctx != NULL);
 
-    if (disp_ctx->trans_sem) {
+    if (disp_ctx->flags.triple_buffer) {
+        lvgl_port_fb_vsync_isr(disp_ctx, &need_yield);
+    } else if (disp_ctx->trans_sem) {
         xSemaphoreGiveFromISR(disp_ctx->trans_sem, &need_yield);
     }
 
@@ -421,7 +803,9 @@ static bool lvgl_port_flush_rgb_vsync_ready_callback(esp_lcd_panel_handle_t pane
     lvgl_port_display_ctx_t *disp_ctx = (lvgl_port_display_ctx_t *)lv_display_get_user_data(disp_drv);
     assert(disp_ctx != NULL);
 
-    if (disp_ctx->trans_sem) {
+    if (disp_ctx->flags.triple_buffer) {
+        lvgl_port_fb_vsync_isr(disp_ctx, &need_yield);
+    } else if (disp_ctx->trans_sem) {
         xSemaphoreGiveFromISR(disp_ctx->trans_sem, &need_yield);
     }
 
@@ -430,59 +814,21 @@ static bool lvgl_port_flush_rgb_vsync_ready_callback(esp_lcd_panel_handle_t pane
 #endif
 #endif
 
-static void _lvgl_port_transform_monochrome(lv_display_t *display, const lv_area_t *area, uint8_t *color_map)
-{
-    uint8_t *buf = color_map;
-    lv_color_t *color = (lv_color_t *)color_map;
-    uint16_t hor_res = lv_display_get_physical_horizontal_resolution(display);
-    uint16_t ver_res = lv_display_get_physical_vertical_resolution(display);
-    uint16_t res = hor_res;
-    bool swap_xy = (lv_display_get_rotation(display) == LV_DISPLAY_ROTATION_90 || lv_display_get_rotation(display) == LV_DISPLAY_ROTATION_270);
-
-    int x1 = area->x1;
-    int x2 = area->x2;
-    int y1 = area->y1;
-    int y2 = area->y2;
-
-    int out_x, out_y;
-    for (int y = y1; y <= y2; y++) {
-        for (int x = x1; x <= x2; x++) {
-            bool chroma_color = (color[hor_res * y + x].blue > 16);
-
-            if (swap_xy) {
-                out_x = y;
-                out_y = x;
-                res = ver_res;
-            } else {
-                out_x = x;
-                out_y = y;
-                res = hor_res;
-            }
-
-            /* Write to the buffer as required for the display.
-            * It writes only 1-bit for monochrome displays mapped vertically.*/
-            buf = color_map + res * (out_y >> 3) + (out_x);
-            if (chroma_color) {
-                (*buf) &= ~(1 << (out_y % 8));
-            } else {
-                (*buf) |= (1 << (out_y % 8));
-            }
-        }
-    }
-}
-
 void lvgl_port_rotate_area(lv_display_t *disp, lv_area_t *area)
 {
-    lv_display_rotation_t rotation = lv_display_get_rotation(disp);
+    lvgl_port_rotate_area_res(area, lv_display_get_rotation(disp), lv_display_get_horizontal_resolution(disp), lv_display_get_vertical_resolution(disp));
+}
 
+/* Rotate area into the panel coordinates, resolution is the rotated resolution of the display */
+static void lvgl_port_rotate_area_res(lv_area_t *area, lv_display_rotation_t rotation, int32_t hres, int32_t vres)
+{
     int32_t w = lv_area_get_width(area);
     int32_t h = lv_area_get_height(area);
 
-    int32_t hres = lv_display_get_horizontal_resolution(disp);
-    int32_t vres = lv_display_get_vertical_resolution(disp);
     if (rotation == LV_DISPLAY_ROTATION_90 || rotation == LV_DISPLAY_ROTATION_270) {
-        vres = lv_display_get_horizontal_resolution(disp);
-        hres = lv_display_get_vertical_resolution(disp);
+        const int32_t tmp = hres;
+        hres = vres;
+        vres = tmp;
     }
 
     switch (rotation) {
@@ -509,6 +855,49 @@ void lvgl_port_rotate_area(lv_display_t *disp, lv_area_t *area)
     }
 }
 
+/* Rotation of the rendered image (display rotation is counter-clockwise, so 90° is rotated by 270°) */
+static lvgl_port_rotate_t lvgl_port_get_image_rotation(lv_display_rotation_t rotation)
+{
+    switch (rotation) {
+    case LV_DISPLAY_ROTATION_90:
+        return LVGL_PORT_ROTATE_270;
+    case LV_DISPLAY_ROTATION_180:
+        return LVGL_PORT_ROTATE_180;
+    case LV_DISPLAY_ROTATION_270:
+        return LVGL_PORT_ROTATE_90;
+    default:
+        return LVGL_PORT_ROTATE_0;
+    }
+}
+
+/* Rotate rendered area into the rotation buffer, RGB565 bytes are swapped in the same pass */
+static void lvgl_port_rotate_buffer(lv_color_format_t cf, const lv_area_t *area, const uint8_t *src, uint8_t *dst, lv_display_rotation_t rotation, bool swap_bytes)
+{
+    const int32_t ww = lv_area_get_width(area);
+    const int32_t hh = lv_area_get_height(area);
+    const int32_t w_stride = lv_draw_buf_width_to_stride(ww, cf);
+    const int32_t h_stride = lv_draw_buf_width_to_stride(hh, cf);
+    const lvgl_port_rotate_t rot = lvgl_port_get_image_rotation(rotation);
+    const int32_t dst_stride = ((rot == LVGL_PORT_ROTATE_90 || rot == LVGL_PORT_ROTATE_270) ? h_stride : w_stride);
+
+    switch (cf) {
+    case LV_COLOR_FORMAT_RGB565:
+        lvgl_port_rotate_rgb565((const uint16_t *)src, (uint16_t *)dst, ww, hh, w_stride, dst_stride, rot, swap_bytes);
+        break;
+    case LV_COLOR_FORMAT_RGB888:
+        lvgl_port_rotate_rgb888(src, dst, ww, hh, w_stride, dst_stride, rot);
+        break;
+    case LV_COLOR_FORMAT_XRGB8888:
+    case LV_COLOR_FORMAT_ARGB8888:
+        lvgl_port_rotate_argb8888((const uint32_t *)src, (uint32_t *)dst, ww, hh, w_stride, dst_stride, rot);
+        break;
+    default:
+        /* Other color formats are not allowed in lvgl_port_add_disp */
+        assert(0);
+        break;
+    }
+}
+
 static void lvgl_port_flush_callback(lv_display_t *drv, const lv_area_t *area, uint8_t *color_map)
 {
     assert(drv != NULL);
@@ -517,61 +906,293 @@ static void lvgl_port_flush_callback(lv_display_t *drv, const lv_area_t *area, u
     lvgl_port_display_ctx_t *disp_ctx = (lvgl_port_display_ctx_t *)lv_display_get_user_data(drv);
     assert(disp_ctx != NULL);
 
+    /* LVGL state is read here, the flush task doesn't touch LVGL */
+    lvgl_port_flush_job_t job = {
+        .area = *area,
+        .color_map = color_map,
+        .last = lv_disp_flush_is_last(drv),
+        .rotation = disp_ctx->current_rotation,
+        .color_format = lv_display_get_color_format(drv),
+        .hres = lv_display_get_horizontal_resolution(drv),
+        .vres = lv_display_get_vertical_resolution(drv),
+    };
+
+    if (disp_ctx->flush_queue) {
+        /* Don't start the next frame, until the flush task finishes this one (LVGL would wait for it) */
+        if (job.last) {
+            lv_timer_pause(lv_display_get_refr_timer(drv));
+        }
+        xQueueSend(disp_ctx->flush_queue, &job, portMAX_DELAY);
+        return;
+    }
+
+    lvgl_port_flush_area(disp_ctx, &job);
+}
+
+/* Convert and send one area to the panel, it runs in LVGL task or in the display flush task (without LVGL mutex) */
+static void lvgl_port_flush_area(lvgl_port_display_ctx_t *disp_ctx, lvgl_port_flush_job_t *job)
+{
+    lv_area_t *area = &job->area;
+    uint8_t *color_map = job->color_map;
+    const bool flush_last = job->last;
+    const uint32_t px_size = lv_color_format_get_size(job->color_format);
+    uint32_t convert_time = 0;
+    uint32_t bytes_sent = 0;
     int offsetx1 = area->x1;
     int offsetx2 = area->x2;
     int offsety1 = area->y1;
     int offsety2 = area->y2;
+    const int64_t flush_start = esp_timer_get_time();
+    int64_t wait_start;
+    uint32_t wait_time = 0;
 
-    /* SW rotation enabled */
-    if (disp_ctx->flags.sw_rotate && (disp_ctx->current_rotation > LV_DISPLAY_ROTATION_0 || disp_ctx->flags.swap_bytes)) {
-        /* SW rotation */
+    if (disp_ctx->flags.monochrome) {
+        /* Rotate and pack pixels into pages of monochromatic display */
+        uint8_t *pages_buff = (uint8_t *)disp_ctx->draw_buffs[2];
+        const int32_t ww = lv_area_get_width(area);
+        const int32_t hh = lv_area_get_height(area);
+        const lvgl_port_rotate_t rot = lvgl_port_get_image_rotation(job->rotation);
+        const int32_t pages_stride = ((rot == LVGL_PORT_ROTATE_90 || rot == LVGL_PORT_ROTATE_270) ? hh : ww);
+        lvgl_port_rotate_rgb565_to_pages((const uint16_t *)color_map, pages_buff, ww, hh, lv_draw_buf_width_to_stride(ww, LV_COLOR_FORMAT_RGB565), pages_stride, rot);
+        convert_time += (esp_timer_get_time() - flush_start);
+        color_map = pages_buff;
+        lvgl_port_rotate_area_res(area, job->rotation, job->hres, job->vres);
+        offsetx1 = area->x1;
+        offsetx2 = area->x2;
+        offsety1 = area->y1;
+        offsety2 = area->y2;
+    } else if (disp_ctx->flags.sw_rotate && (job->rotation > LV_DISPLAY_ROTATION_0 || disp_ctx->flags.swap_bytes)) {
+        /* SW rotation (with swap bytes in one pass) */
         if (disp_ctx->draw_buffs[2]) {
-            int32_t ww = lv_area_get_width(area);
-            int32_t hh = lv_area_get_height(area);
-            lv_color_format_t cf = lv_display_get_color_format(drv);
-            uint32_t w_stride = lv_draw_buf_width_to_stride(ww, cf);
-            uint32_t h_stride = lv_draw_buf_width_to_stride(hh, cf);
-            if (disp_ctx->current_rotation == LV_DISPLAY_ROTATION_180) {
-                lv_draw_sw_rotate(color_map, disp_ctx->draw_buffs[2], hh, ww, h_stride, h_stride, LV_DISPLAY_ROTATION_180, cf);
-            } else if (disp_ctx->current_rotation == LV_DISPLAY_ROTATION_90) {
-                lv_draw_sw_rotate(color_map, disp_ctx->draw_buffs[2], ww, hh, w_stride, h_stride, LV_DISPLAY_ROTATION_270, cf);
-            } else if (disp_ctx->current_rotation == LV_DISPLAY_ROTATION_270) {
-                lv_draw_sw_rotate(color_map, disp_ctx->draw_buffs[2], ww, hh, w_stride, h_stride, LV_DISPLAY_ROTATION_90, cf);
+            uint8_t *rot_buff = (uint8_t *)disp_ctx->draw_buffs[2];
+            if (disp_ctx->rot_sem) {
+                /* Wait for a free rotation buffer, it can be still used by one of the previous transfers */
+                wait_start = esp_timer_get_time();
+                xSemaphoreTake(disp_ctx->rot_sem, portMAX_DELAY);
+                wait_time += (esp_timer_get_time() - wait_start);
+                rot_buff = (uint8_t *)disp_ctx->draw_buffs[2 + disp_ctx->rot_buff_idx];
+                disp_ctx->rot_buff_idx = (disp_ctx->rot_buff_idx + 1) % LVGL_PORT_ROT_BUFFS;
             }
-            color_map = (uint8_t *)disp_ctx->draw_buffs[2];
-            lvgl_port_rotate_area(drv, (lv_area_t *)area);
+            const int64_t convert_start = esp_timer_get_time();
+            lvgl_port_rotate_buffer(job->color_format, area, color_map, rot_buff, job->rotation, disp_ctx->flags.swap_bytes);
+            convert_time += (esp_timer_get_time() - convert_start);
+            color_map = rot_buff;
+            lvgl_port_rotate_area_res(area, job->rotation, job->hres, job->vres);
             offsetx1 = area->x1;
             offsetx2 = area->x2;
             offsety1 = area->y1;
             offsety2 = area->y2;
+
+            /* LVGL buffer is not needed anymore, LVGL can render next area during the transfer */
+            if (disp_ctx->rot_sem) {
+                lvgl_port_disp_flush_ready(disp_ctx);
+            }
         }
     } else if (disp_ctx->flags.swap_bytes) {
         size_t len = lv_area_get_size(area);
         lv_draw_sw_rgb565_swap(color_map, len);
-    }
-
-    /* Transfer data in buffer for monochromatic screen */
-    if (disp_ctx->flags.monochrome) {
-        _lvgl_port_transform_monochrome(drv, area, color_map);
+        convert_time += (esp_timer_get_time() - flush_start);
     }
 
     if ((disp_ctx->disp_type == LVGL_PORT_DISP_TYPE_RGB || disp_ctx->disp_type == LVGL_PORT_DISP_TYPE_DSI) && (disp_ctx->flags.direct_mode || disp_ctx->flags.full_refresh)) {
-        if (lv_disp_flush_is_last(drv)) {
+        if (disp_ctx->flags.triple_buffer) {
+            lvgl_port_fb_queue(disp_ctx, color_map);
+            bytes_sent = job->hres * job->vres * px_size;
+        } else if (flush_last) {
             /* If the interface is I80 or SPI, this step cannot be used for drawing. */
-            esp_lcd_panel_draw_bitmap(disp_ctx->panel_handle, 0, 0, lv_disp_get_hor_res(drv), lv_disp_get_ver_res(drv), color_map);
+            esp_lcd_panel_draw_bitmap(disp_ctx->panel_handle, 0, 0, job->hres, job->vres, color_map);
+            bytes_sent = job->hres * job->vres * px_size;
             /* Waiting for the last frame buffer to complete transmission */
+            wait_start = esp_timer_get_time();
             xSemaphoreTake(disp_ctx->trans_sem, 0);
             xSemaphoreTake(disp_ctx->trans_sem, portMAX_DELAY);
+            wait_time += (esp_timer_get_time() - wait_start);
+#if LVGL_PORT_FB_SYNC_ASYNC
+            /* The other framebuffer is not displayed anymore, copy the rendered areas into it */
+            if (disp_ctx->sync_mcp) {
+                lvgl_port_fb_sync_start(disp_ctx, color_map);
+            }
+#endif
         }
     } else {
         esp_lcd_panel_draw_bitmap(disp_ctx->panel_handle, offsetx1, offsety1, offsetx2 + 1, offsety2 + 1, color_map);
+        /* Monochromatic display gets 1 bit per pixel */
+        const uint32_t px_cnt = (offsetx2 - offsetx1 + 1) * (offsety2 - offsety1 + 1);
+        bytes_sent = (disp_ctx->flags.monochrome ? px_cnt / 8 : px_cnt * px_size);
+    }
+
+    /* Flush counters are updated before LVGL can continue (flush ready) */
+    const int64_t now = esp_timer_get_time();
+    portENTER_CRITICAL(&disp_ctx->stats_lock);
+    disp_ctx->stats.flushes++;
+    disp_ctx->stats.wait_time_us += wait_time;
+    disp_ctx->stats.convert_time_us += convert_time;
+    disp_ctx->stats.bytes_sent += bytes_sent;
+    disp_ctx->stats_frame_busy += (now - flush_start);
+    if (flush_last) {
+        lvgl_port_stats_frame_done(disp_ctx, now);
     }
+    portEXIT_CRITICAL(&disp_ctx->stats_lock);
 
     if (disp_ctx->disp_type == LVGL_PORT_DISP_TYPE_RGB || (disp_ctx->disp_type == LVGL_PORT_DISP_TYPE_DSI && (disp_ctx->flags.direct_mode || disp_ctx->flags.full_refresh))) {
-        lv_disp_flush_ready(drv);
+        lvgl_port_disp_flush_ready(disp_ctx);
     }
 }
 
+/* LVGL can use the draw buffer again (it can be called from ISR) */
+static bool lvgl_port_disp_flush_ready(lvgl_port_display_ctx_t *disp_ctx)
+{
+    BaseType_t need_yield = pdFALSE;
+
+    lv_disp_flush_ready(disp_ctx->disp_drv);
+    if (xPortInIsrContext() == pdTRUE) {
+        xSemaphoreGiveFromISR(disp_ctx->flush_done_sem, &need_yield);
+    } else {
+        xSemaphoreGive(disp_ctx->flush_done_sem);
+    }
+    if (disp_ctx->flush_task) {
+        /* Only one flush of the display is in progress, there are no concurrent writers */
+        disp_ctx->flush_done_cnt++;
+        if (xPortInIsrContext() == pdTRUE) {
+            vTaskNotifyGiveFromISR(disp_ctx->flush_task, &need_yield);
+        } else {
+            xTaskNotifyGive(disp_ctx->flush_task);
+        }
+    }
+
+    return (need_yield == pdTRUE);
+}
+
+/* Block until the draw buffer is flushed (instead of busy waiting in LVGL) */
+static void lvgl_port_flush_wait(lvgl_port_display_ctx_t *disp_ctx)
+{
+    while (disp_ctx->disp_drv->flushing) {
+        xSemaphoreTake(disp_ctx->flush_done_sem, portMAX_DELAY);
+    }
+}
+
+static void lvgl_port_flush_wait_callback(lv_display_t *disp)
+{
+    lvgl_port_display_ctx_t *disp_ctx = (lvgl_port_display_ctx_t *)lv_display_get_user_data(disp);
+    assert(disp_ctx != NULL);
+    lvgl_port_flush_wait(disp_ctx);
+}
+
+/*
+ * Display flush task: conversions, draw_bitmap and waiting for the panel are done here, so the LVGL task can render
+ * other displays meanwhile. It doesn't take the LVGL mutex and it doesn't read LVGL state, the queued job has all
+ * it needs. The only interaction with LVGL is the flush ready and the refresh timer, which is resumed from the LVGL
+ * task (lvgl_port_disp_refr_resume). Performance counters are shared with the LVGL task under stats_lock.
+ */
+static void lvgl_port_flush_task(void *arg)
+{
+    lvgl_port_display_ctx_t *disp_ctx = (lvgl_port_display_ctx_t *)arg;
+    lvgl_port_flush_job_t job;
+    uint32_t flush_cnt = 0;
+
+    while (xQueueReceive(disp_ctx->flush_queue, &job, portMAX_DELAY) == pdTRUE && job.color_map != NULL) {
+        flush_cnt++;
+        lvgl_port_flush_area(disp_ctx, &job);
+
+        if (job.last) {
+            /* Frame is done, when the panel takes the last area */
+            while ((int32_t)(disp_ctx->flush_done_cnt - flush_cnt) < 0) {
+                ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            }
+            disp_ctx->refr_resume = true;
+            lvgl_port_task_wake(LVGL_PORT_EVENT_DISPLAY, NULL);
+        }
+    }
+
+    xSemaphoreGive(disp_ctx->flush_exit_sem);
+    vTaskDelete(NULL);
+}
+
+static esp_err_t lvgl_port_flush_task_init(lvgl_port_display_ctx_t *disp_ctx, const lvgl_port_display_cfg_t *disp_cfg)
+{
+    const uint32_t cores_mask = ((1UL << configNUM_CORES) - 1);
+    const uint32_t core_mask = (disp_cfg->flush_task_affinity == -1 ? 0 : (uint32_t)disp_cfg->flush_task_affinity);
+    ESP_RETURN_ON_FALSE((core_mask & ~cores_mask) == 0 && __builtin_popcount(core_mask) <= 1, ESP_ERR_INVALID_ARG, TAG, "Bad core mask for flush task! Maximum core number is %d", (configNUM_CORES - 1));
+
+    disp_ctx->flush_queue = xQueueCreate(LVGL_PORT_FLUSH_QUEUE_LEN, sizeof(lvgl_port_flush_job_t));
+    disp_ctx->flush_exit_sem = xSemaphoreCreateBinary();
+    ESP_RETURN_ON_FALSE(disp_ctx->flush_queue && disp_ctx->flush_exit_sem, ESP_ERR_NO_MEM, TAG, "Create flush task queue fail!");
+
+    const uint32_t stack = (disp_cfg->flush_task_stack > 0 ? disp_cfg->flush_task_stack : LVGL_PORT_FLUSH_TASK_STACK_DEFAULT);
+    BaseType_t res;
+    if (core_mask == 0) {
+        res = xTaskCreate(lvgl_port_flush_task, "taskLVGLflush", stack, disp_ctx, disp_cfg->flush_task_priority, &disp_ctx->flush_task);
+    } else {
+        res = xTaskCreatePinnedToCore(lvgl_port_flush_task, "taskLVGLflush", stack, disp_ctx, disp_cfg->flush_task_priority, &disp_ctx->flush_task, __builtin_ctz(core_mask));
+    }
+    ESP_RETURN_ON_FALSE(res == pdPASS, ESP_FAIL, TAG, "Create flush task fail!");
+
+    return ESP_OK;
+}
+
+static void lvgl_port_flush_task_deinit(lvgl_port_display_ctx_t *disp_ctx)
+{
+    if (disp_ctx->flush_task) {
+        /* Stop request is handled after all queued areas, the task uses the display context until it exits */
+        const lvgl_port_flush_job_t job = {0};
+        xQueueSend(disp_ctx->flush_queue, &job, portMAX_DELAY);
+        xSemaphoreTake(disp_ctx->flush_exit_sem, portMAX_DELAY);
+        disp_ctx->flush_task = NULL;
+    }
+    if (disp_ctx->flush_queue) {
+        vQueueDelete(disp_ctx->flush_queue);
+        disp_ctx->flush_queue = NULL;
+    }
+    if (disp_ctx->flush_exit_sem) {
+        vSemaphoreDelete(disp_ctx->flush_exit_sem);
+        disp_ctx->flush_exit_sem = NULL;
+    }
+}
+
+/* It must be called with stats_lock taken */
+static void lvgl_port_stats_frame_done(lvgl_port_display_ctx_t *disp_ctx, int64_t now)
+{
+    lvgl_port_disp_stats_t *stats = &disp_ctx->stats;
+    const uint32_t frame_time = (uint32_t)(now - disp_ctx->stats_frame_start);
+
+    stats->frames++;
+    stats->frame_time_us += frame_time;
+    if (frame_time > stats->frame_time_max_us) {
+        stats->frame_time_max_us = frame_time;
+    }
+    stats->render_time_us += (frame_time > disp_ctx->stats_frame_busy ? frame_time - disp_ctx->stats_frame_busy : 0);
+
+    /* Rolling FPS, updated once per window */
+    disp_ctx->stats_fps_frames++;
+    const int64_t window = now - disp_ctx->stats_fps_start;
+    if (window >= LVGL_PORT_STATS_FPS_WINDOW_US) {
+        stats->fps = (float)disp_ctx->stats_fps_frames * 1000000.0f / (float)window;
+        disp_ctx->stats_fps_start = now;
+        disp_ctx->stats_fps_frames = 0;
+    }
+}
+
+#if LVGL_PORT_STATS_FLUSH_WAIT
+/* LVGL waits for the previous flush (transfer of the buffer to the panel) */
+static void lvgl_port_display_flush_wait_callback(lv_event_t *e)
+{
+    lvgl_port_display_ctx_t *disp_ctx = (lvgl_port_display_ctx_t *)lv_event_get_user_data(e);
+    assert(disp_ctx != NULL);
+    const int64_t now = esp_timer_get_time();
+
+    if (lv_event_get_code(e) == LV_EVENT_FLUSH_WAIT_START) {
+        disp_ctx->stats_wait_start = now;
+    } else if (disp_ctx->stats_wait_start != 0) {
+        const uint32_t wait_time = (uint32_t)(now - disp_ctx->stats_wait_start);
+        portENTER_CRITICAL(&disp_ctx->stats_lock);
+        disp_ctx->stats.wait_time_us += wait_time;
+        disp_ctx->stats_frame_busy += wait_time;
+        portEXIT_CRITICAL(&disp_ctx->stats_lock);
+        disp_ctx->stats_wait_start = 0;
+    }
+}
+#endif
+
 static void lvgl_port_disp_rotation_update(lvgl_port_display_ctx_t *disp_ctx)
 {
     assert(disp_ctx != NULL);
@@ -581,9 +1202,11 @@ static void lvgl_port_disp_rotation_update(lvgl_port_display_ctx_t *disp_ctx)
         return;
     }
 
+    /* Monochromatic display is rotated in SW when packing the pixels, the panel keeps the configured base orientation */
+    const lv_display_rotation_t rotation = (disp_ctx->flags.monochrome ? LV_DISPLAY_ROTATION_0 : disp_ctx->current_rotation);
     esp_lcd_panel_handle_t control_handle = (disp_ctx->control_handle ? disp_ctx->control_handle : disp_ctx->panel_handle);
     /* Solve rotation screen and touch */
-    switch (lv_display_get_rotation(disp_ctx->disp_drv)) {
+    switch (rotation) {
     case LV_DISPLAY_ROTATION_0:
         /* Rotate LCD display */
         esp_lcd_panel_swap_xy(control_handle, disp_ctx->rotation.swap_xy);
@@ -627,6 +1250,380 @@ static void lvgl_port_disp_size_update_callback(lv_event_t *e)
 
 static void lvgl_port_display_invalidate_callback(lv_event_t *e)
 {
+    lvgl_port_display_ctx_t *disp_ctx = (lvgl_port_display_ctx_t *)lv_event_get_user_data(e);
+
+    /* Monochromatic display is written by pages of 8 rows (display rows are LVGL columns in 90° and 270° rotation) */
+    if (disp_ctx->flags.monochrome && lv_event_get_code(e) == LV_EVENT_INVALIDATE_AREA) {
+        lv_area_t *area = (lv_area_t *)lv_event_get_param(e);
+        const lv_display_rotation_t rotation = lv_display_get_rotation((lv_display_t *)lv_event_get_current_target(e));
+        if (rotation == LV_DISPLAY_ROTATION_90 || rotation == LV_DISPLAY_ROTATION_270) {
+            area->x1 &= ~0x7;
+            area->x2 |= 0x7;
+        } else {
+            area->y1 &= ~0x7;
+            area->y2 |= 0x7;
+        }
+    }
+
     /* Wake LVGL task, if needed */
     lvgl_port_task_wake(LVGL_PORT_EVENT_DISPLAY, NULL);
 }
+
+/* Cost of drawing the area: transferred pixels and transactions (area is split by the size of draw buffer) */
+static uint32_t lvgl_port_area_cost(lvgl_port_display_ctx_t *disp_ctx, const lv_area_t *area)
+{
+    const int32_t w = lv_area_get_width(area);
+    const int32_t h = lv_area_get_height(area);
+    uint32_t transactions = 1;
+
+    if (!disp_ctx->flags.direct_mode) {
+        const uint32_t stride = lv_draw_buf_width_to_stride(w, lv_display_get_color_format(disp_ctx->disp_drv));
+        const uint32_t max_rows = (stride > 0 ? disp_ctx->draw_buff_size / stride : 0);
+        if (max_rows > 0) {
+            transactions = (h + max_rows - 1) / max_rows;
+        }
+    }
+
+    return transactions * disp_ctx->trans_overhead_px + w * h;
+}
+
+static inline bool lvgl_port_area_is_in(const lv_area_t *in, const lv_area_t *holder)
+{
+    return (in->x1 >= holder->x1 && in->y1 >= holder->y1 && in->x2 <= holder->x2 && in->y2 <= holder->y2);
+}
+
+/*
+ * Merge invalidated areas of the display. Two areas are replaced by their bounding box, when the saved transactions
+ * cost more than the extra (not invalidated) pixels. The pair with the highest saving is merged first.
+ */
+static void lvgl_port_merge_areas(lvgl_port_display_ctx_t *disp_ctx)
+{
+    lv_display_t *disp = disp_ctx->disp_drv;
+    uint32_t cost[LV_INV_BUF_SIZE];
+    lv_area_t merged;
+
+    for (uint32_t i = 0; i < disp->inv_p; i++) {
+        cost[i] = lvgl_port_area_cost(disp_ctx, &disp->inv_areas[i]);
+    }
+
+    while (1) {
+        int32_t best_saving = 0;
+        int best_i = -1;
+        int best_j = -1;
+
+        for (uint32_t i = 0; i < disp->inv_p; i++) {
+            if (disp->inv_area_joined[i]) {
+                continue;
+            }
+            for (uint32_t j = i + 1; j < disp->inv_p; j++) {
+                if (disp->inv_area_joined[j]) {
+                    continue;
+                }
+                merged.x1 = LV_MIN(disp->inv_areas[i].x1, disp->inv_areas[j].x1);
+                merged.y1 = LV_MIN(disp->inv_areas[i].y1, disp->inv_areas[j].y1);
+                merged.x2 = LV_MAX(disp->inv_areas[i].x2, disp->inv_areas[j].x2);
+                merged.y2 = LV_MAX(disp->inv_areas[i].y2, disp->inv_areas[j].y2);
+                const int32_t saving = (int32_t)(cost[i] + cost[j]) - (int32_t)lvgl_port_area_cost(disp_ctx, &merged);
+                if (saving > best_saving) {
+                    best_saving = saving;
+                    best_i = i;
+                    best_j = j;
+                }
+            }
+        }
+
+        if (best_i < 0) {
+            break;
+        }
+
+        /* Merge the best pair and drop all areas covered by the result */
+        lv_area_t *area = &disp->inv_areas[best_i];
+        area->x1 = LV_MIN(area->x1, disp->inv_areas[best_j].x1);
+        area->y1 = LV_MIN(area->y1, disp->inv_areas[best_j].y1);
+        area->x2 = LV_MAX(area->x2, disp->inv_areas[best_j].x2);
+        area->y2 = LV_MAX(area->y2, disp->inv_areas[best_j].y2);
+        cost[best_i] = lvgl_port_area_cost(disp_ctx, area);
+        for (uint32_t k = 0; k < disp->inv_p; k++) {
+            if ((int)k != best_i && !disp->inv_area_joined[k] && lvgl_port_area_is_in(&disp->inv_areas[k], area)) {
+                disp->inv_area_joined[k] = 1;
+            }
+        }
+    }
+}
+
+/* Lease buffer from the shared pool (buffers are leased in order) or allocate it */
+static void *lvgl_port_buff_alloc(lvgl_port_display_ctx_t *disp_ctx, size_t size, uint32_t caps)
+{
+    if (!disp_ctx->flags.buff_pool) {
+        return heap_caps_malloc(size, caps);
+    }
+
+    if (size > lvgl_port_buff_pool.buff_size || disp_ctx->pool_next >= lvgl_port_buff_pool.buff_count) {
+        ESP_LOGE(TAG, "Buffer pool has not enough buffers of %u bytes!", (unsigned int)size);
+        return NULL;
+    }
+    return lvgl_port_buff_pool.buffs[disp_ctx->pool_next++];
+}
+
+/* Free buffer, buffers of the shared pool stay allocated */
+static void lvgl_port_buff_free(void *buff)
+{
+    if (buff == NULL) {
+        return;
+    }
+    for (uint32_t i = 0; i < lvgl_port_buff_pool.buff_count; i++) {
+        if (buff == lvgl_port_buff_pool.buffs[i]) {
+            return;
+        }
+    }
+    free(buff);
+}
+
+static esp_err_t lvgl_port_buff_pool_attach(lvgl_port_display_ctx_t *disp_ctx)
+{
+    ESP_RETURN_ON_FALSE(lvgl_port_buff_pool.buff_count > 0, ESP_ERR_INVALID_STATE, TAG, "Buffer pool is not created");
+
+    for (int i = 0; i < LVGL_PORT_BUFF_POOL_MAX_DISPS; i++) {
+        if (lvgl_port_buff_pool.disps[i] == NULL) {
+            lvgl_port_buff_pool.disps[i] = disp_ctx;
+            disp_ctx->flags.buff_pool = 1;
+            return ESP_OK;
+        }
+    }
+    ESP_LOGE(TAG, "Maximum number of displays using buffer pool is %d", LVGL_PORT_BUFF_POOL_MAX_DISPS);
+    return ESP_ERR_NO_MEM;
+}
+
+static void lvgl_port_buff_pool_detach(lvgl_port_display_ctx_t *disp_ctx)
+{
+    for (int i = 0; i < LVGL_PORT_BUFF_POOL_MAX_DISPS; i++) {
+        if (lvgl_port_buff_pool.disps[i] == disp_ctx) {
+            lvgl_port_buff_pool.disps[i] = NULL;
+        }
+    }
+}
+
+/* Buffers of the pool are shared, wait until the other displays finish the transfers from them */
+static void lvgl_port_buff_pool_wait(lvgl_port_display_ctx_t *disp_ctx)
+{
+    for (int i = 0; i < LVGL_PORT_BUFF_POOL_MAX_DISPS; i++) {
+        lvgl_port_display_ctx_t *other = lvgl_port_buff_pool.disps[i];
+        if (other == NULL || other == disp_ctx || other->disp_drv == NULL) {
+            continue;
+        }
+
+        if (other->rot_sem) {
+            /* Transfers from rotation buffers, take all the buffers and give them back */
+            for (int j = 0; j < LVGL_PORT_ROT_BUFFS; j++) {
+                xSemaphoreTake(other->rot_sem, portMAX_DELAY);
+            }
+            for (int j = 0; j < LVGL_PORT_ROT_BUFFS; j++) {
+                xSemaphoreGive(other->rot_sem);
+            }
+        }
+        /* Transfer from the draw buffer (LVGL waits for its own display in the same way) */
+        lvgl_port_flush_wait(other);
+    }
+}
+
+/* Panel switched to the last given framebuffer, or to the one being given, when the driver is taking it just now */
+static void lvgl_port_fb_vsync_isr(lvgl_port_display_ctx_t *disp_ctx, BaseType_t *need_yield)
+{
+    portENTER_CRITICAL_ISR(&disp_ctx->fbs_lock);
+    disp_ctx->fb_shown = BIT(disp_ctx->fb_given) | (disp_ctx->fb_giving >= 0 ? BIT(disp_ctx->fb_giving) : 0);
+    disp_ctx->fb_vsync = true;
+    const bool wake = disp_ctx->fb_wait;
+    disp_ctx->fb_wait = false;
+    portEXIT_CRITICAL_ISR(&disp_ctx->fbs_lock);
+
+    if (wake) {
+        xSemaphoreGiveFromISR(disp_ctx->trans_sem, need_yield);
+    }
+}
+
+/* Queue rendered frame for the next vsync and give LVGL the framebuffer, which is neither displayed nor queued */
+static void lvgl_port_fb_queue(lvgl_port_display_ctx_t *disp_ctx, uint8_t *fb)
+{
+    lv_display_t *disp = disp_ctx->disp_drv;
+    const int8_t idx = (fb == disp_ctx->fbs[0] ? 0 : (fb == disp_ctx->fbs[1] ? 1 : 2));
+    int8_t free_idx = -1;
+
+    /* Vsync can come anytime, also while the driver is taking the new frame (it can display the new or the last given one) */
+    portENTER_CRITICAL(&disp_ctx->fbs_lock);
+    /* Frame not displayed yet is dropped and replaced by the newer one */
+    const bool dropped = !disp_ctx->fb_vsync;
+    disp_ctx->fb_giving = idx;
+    portEXIT_CRITICAL(&disp_ctx->fbs_lock);
+
+    esp_lcd_panel_draw_bitmap(disp_ctx->panel_handle, 0, 0, lv_disp_get_hor_res(disp), lv_disp_get_ver_res(disp), fb);
+
+    portENTER_CRITICAL(&disp_ctx->fbs_lock);
+    disp_ctx->fb_given = idx;
+    disp_ctx->fb_giving = -1;
+    disp_ctx->fb_vsync = false;
+    portEXIT_CRITICAL(&disp_ctx->fbs_lock);
+    if (dropped) {
+        portENTER_CRITICAL(&disp_ctx->stats_lock);
+        disp_ctx->stats.dropped_frames++;
+        portEXIT_CRITICAL(&disp_ctx->stats_lock);
+    }
+
+    /* Free framebuffer is not displayed and not given. If the displayed one is not known (vsync came while giving the previous frame), wait for the next vsync. */
+    while (free_idx < 0) {
+        portENTER_CRITICAL(&disp_ctx->fbs_lock);
+        const uint8_t busy = disp_ctx->fb_shown | BIT(idx);
+        free_idx = (!(busy & BIT(0)) ? 0 : (!(busy & BIT(1)) ? 1 : (!(busy & BIT(2)) ? 2 : -1)));
+        disp_ctx->fb_wait = (free_idx < 0);
+        portEXIT_CRITICAL(&disp_ctx->fbs_lock);
+        if (free_idx < 0) {
+            xSemaphoreTake(disp_ctx->trans_sem, portMAX_DELAY);
+        }
+    }
+
+    /* LVGL swaps its draw buffers after the flush, the next frame is rendered into the free framebuffer */
+    lv_draw_buf_t *next = (disp->buf_act == disp->buf_1 ? disp->buf_2 : disp->buf_1);
+    next->data = disp_ctx->fbs[free_idx];
+    next->unaligned_data = disp_ctx->fbs[free_idx];
+}
+
+#if LVGL_PORT_FB_SYNC_ASYNC
+static bool lvgl_port_fb_sync_done_callback(async_memcpy_handle_t mcp, async_memcpy_event_t *event, void *cb_args)
+{
+    BaseType_t need_yield = pdFALSE;
+    lvgl_port_display_ctx_t *disp_ctx = (lvgl_port_display_ctx_t *)cb_args;
+    assert(disp_ctx != NULL);
+
+    xSemaphoreGiveFromISR(disp_ctx->sync_sem, &need_yield);
+    return (need_yield == pdTRUE);
+}
+
+/* Copy row bands of the areas rendered into the front framebuffer into the back one */
+static void lvgl_port_fb_sync_start(lvgl_port_display_ctx_t *disp_ctx, uint8_t *front)
+{
+    lv_display_t *disp = disp_ctx->disp_drv;
+    lvgl_port_fb_band_t *bands = disp_ctx->sync_bands;
+    const uint32_t stride = lv_draw_buf_width_to_stride(lv_display_get_horizontal_resolution(disp), lv_display_get_color_format(disp));
+    uint32_t cnt = 0;
+
+    /* Bands sorted by offset, aligned to cache lines (front framebuffer is complete, copying more is harmless) */
+    for (uint32_t i = 0; i < disp->inv_p; i++) {
+        if (disp->inv_area_joined[i]) {
+            continue;
+        }
+        const uint32_t start = (disp->inv_areas[i].y1 * stride) & ~(LVGL_PORT_FB_SYNC_ALIGN - 1);
+        const uint32_t end = LV_MIN(((disp->inv_areas[i].y2 + 1) * stride + LVGL_PORT_FB_SYNC_ALIGN - 1) & ~(LVGL_PORT_FB_SYNC_ALIGN - 1), disp_ctx->sync_fb_size);
+        uint32_t j = cnt++;
+        while (j > 0 && bands[j - 1].offset > start) {
+            bands[j] = bands[j - 1];
+            j--;
+        }
+        bands[j].offset = start;
+        bands[j].size = end - start;
+    }
+
+    /* Merge overlapping and neighbouring bands */
+    uint32_t merged = 0;
+    for (uint32_t i = 1; i < cnt; i++) {
+        lvgl_port_fb_band_t *last = &bands[merged];
+        if (bands[i].offset <= last->offset + last->size) {
+            last->size = LV_MAX(last->offset + last->size, bands[i].offset + bands[i].size) - last->offset;
+        } else {
+            bands[++merged] = bands[i];
+        }
+    }
+    disp_ctx->sync_bands_cnt = (cnt > 0 ? merged + 1 : 0);
+    disp_ctx->sync_dst = (front == disp_ctx->sync_fbs[0] ? disp_ctx->sync_fbs[1] : disp_ctx->sync_fbs[0]);
+
+    for (uint32_t i = 0; i < disp_ctx->sync_bands_cnt; i++) {
+        uint8_t *src = front + bands[i].offset;
+        uint8_t *dst = disp_ctx->sync_dst + bands[i].offset;
+        esp_cache_msync(src, bands[i].size, ESP_CACHE_MSYNC_FLAG_DIR_C2M | ESP_CACHE_MSYNC_FLAG_UNALIGNED);
+        if (esp_async_memcpy(disp_ctx->sync_mcp, dst, src, bands[i].size, lvgl_port_fb_sync_done_callback, disp_ctx) == ESP_OK) {
+            disp_ctx->sync_pending++;
+        } else {
+            /* No free transaction, copy by CPU (cache of this band must not be invalidated then) */
+            memcpy(dst, src, bands[i].size);
+            bands[i].size = 0;
+        }
+    }
+}
+
+/* Wait for the framebuffers sync, before LVGL starts rendering into the back framebuffer */
+static void lvgl_port_fb_sync_wait(lvgl_port_display_ctx_t *disp_ctx)
+{
+    for (; disp_ctx->sync_pending > 0; disp_ctx->sync_pending--) {
+        xSemaphoreTake(disp_ctx->sync_sem, portMAX_DELAY);
+    }
+
+    /* The band was written by DMA, drop old data from cache */
+    for (uint32_t i = 0; i < disp_ctx->sync_bands_cnt; i++) {
+        if (disp_ctx->sync_bands[i].size > 0) {
+            esp_cache_msync(disp_ctx->sync_dst + disp_ctx->sync_bands[i].offset, disp_ctx->sync_bands[i].size, ESP_CACHE_MSYNC_FLAG_DIR_M2C);
+        }
+    }
+    disp_ctx->sync_bands_cnt = 0;
+
+    /* The areas are already copied, LVGL doesn't need to do it */
+    lvgl_port_ll_clear(&disp_ctx->disp_drv->sync_areas);
+}
+
+static void lvgl_port_fb_sync_deinit(lvgl_port_display_ctx_t *disp_ctx)
+{
+    if (disp_ctx->sync_sem) {
+        for (; disp_ctx->sync_pending > 0; disp_ctx->sync_pending--) {
+            xSemaphoreTake(disp_ctx->sync_sem, portMAX_DELAY);
+        }
+        vSemaphoreDelete(disp_ctx->sync_sem);
+        disp_ctx->sync_sem = NULL;
+    }
+    if (disp_ctx->sync_mcp) {
+        esp_async_memcpy_uninstall(disp_ctx->sync_mcp);
+        disp_ctx->sync_mcp = NULL;
+    }
+}
+#endif
+
+static void lvgl_port_display_refr_start_callback(lv_event_t *e)
+{
+    lvgl_port_display_ctx_t *disp_ctx = (lvgl_port_display_ctx_t *)lv_event_get_user_data(e);
+    assert(disp_ctx != NULL);
+    lv_display_t *disp = disp_ctx->disp_drv;
+
+    const int64_t frame_start = esp_timer_get_time();
+    portENTER_CRITICAL(&disp_ctx->stats_lock);
+    disp_ctx->stats_frame_start = frame_start;
+    disp_ctx->stats_frame_busy = 0;
+    portEXIT_CRITICAL(&disp_ctx->stats_lock);
+
+    if (disp_ctx->flags.buff_pool) {
+        lvgl_port_buff_pool_wait(disp_ctx);
+        const uint32_t wait_time = (uint32_t)(esp_timer_get_time() - frame_start);
+        portENTER_CRITICAL(&disp_ctx->stats_lock);
+        disp_ctx->stats.wait_time_us += wait_time;
+        disp_ctx->stats_frame_busy += wait_time;
+        portEXIT_CRITICAL(&disp_ctx->stats_lock);
+    }
+
+#if LVGL_PORT_FB_SYNC_ASYNC
+    if (disp_ctx->sync_mcp) {
+        lvgl_port_fb_sync_wait(disp_ctx);
+        const uint32_t wait_time = (uint32_t)(esp_timer_get_time() - frame_start);
+        portENTER_CRITICAL(&disp_ctx->stats_lock);
+        disp_ctx->stats.wait_time_us += wait_time;
+        disp_ctx->stats_frame_busy += wait_time;
+        portEXIT_CRITICAL(&disp_ctx->stats_lock);
+    }
+#endif
+
+    if (!disp_ctx->flags.merge_areas) {
+        return;
+    }
+
+    /* Layout changes can invalidate more areas, update it before merging (LVGL does it right after this event) */
+    lv_obj_update_layout(lv_display_get_screen_active(disp));
+    lv_obj_update_layout(lv_display_get_layer_bottom(disp));
+    lv_obj_update_layout(lv_display_get_layer_top(disp));
+    lv_obj_update_layout(lv_display_get_layer_sys(disp));
+
+    lvgl_port_merge_areas(disp_ctx);
+}
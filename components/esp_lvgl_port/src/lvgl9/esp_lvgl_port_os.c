@@ -0,0 +1,172 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <inttypes.h>
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_lvgl_port.h"
+#include "esp_lvgl_port_priv.h"
+#include "lvgl.h"
+
+#if LV_USE_OS == LV_OS_CUSTOM
+
+static const char *TAG = "LVGL";
+
+/* Name of the thread in lv_thread_init was added in LVGL 9.3 */
+#define LVGL_PORT_OS_THREAD_NAME    (LVGL_VERSION_MAJOR > 9 || LVGL_VERSION_MINOR >= 3)
+/* ISR signal of the thread sync was added in LVGL 9.2 */
+#define LVGL_PORT_OS_SYNC_ISR       (LVGL_VERSION_MAJOR > 9 || LVGL_VERSION_MINOR >= 2)
+/* Idle percent of the OS was added in LVGL 9.1 */
+#define LVGL_PORT_OS_IDLE_PERCENT   (LVGL_VERSION_MAJOR > 9 || LVGL_VERSION_MINOR >= 1)
+
+/*******************************************************************************
+* Local variables
+*******************************************************************************/
+/* Indexes of running threads (bit n = thread n), the new thread gets the lowest free index */
+static uint32_t lvgl_port_os_threads;
+
+/*******************************************************************************
+* Private functions
+*******************************************************************************/
+
+static void lvgl_port_os_thread_task(void *arg)
+{
+    lv_thread_t *thread = arg;
+    thread->callback(thread->user_data);
+
+    /* LVGL deletes the thread by lv_thread_delete */
+    vTaskSuspend(NULL);
+}
+
+/*******************************************************************************
+* LVGL OS abstraction layer
+*******************************************************************************/
+
+#if LVGL_PORT_OS_THREAD_NAME
+lv_result_t lv_thread_init(lv_thread_t *thread, const char *const name, lv_thread_prio_t prio, void (*callback)(void *), size_t stack_size, void *user_data)
+#else
+lv_result_t lv_thread_init(lv_thread_t *thread, lv_thread_prio_t prio, void (*callback)(void *), size_t stack_size, void *user_data)
+#endif
+{
+#if !LVGL_PORT_OS_THREAD_NAME
+    const char *name = "taskLVGLdraw";
+#endif
+    /* Threads are created and deleted by LVGL with LVGL mutex taken */
+    uint32_t index = 0;
+    while (index < 31 && (lvgl_port_os_threads & (1UL << index))) {
+        index++;
+    }
+    lvgl_port_thread_cfg_t cfg;
+    lvgl_port_get_thread_cfg(index, &cfg);
+
+    thread->index = index;
+    thread->callback = callback;
+    thread->user_data = user_data;
+    const uint32_t stack = (cfg.stack > 0 ? cfg.stack : stack_size);
+    const UBaseType_t priority = (cfg.priority > 0 ? cfg.priority : prio);
+
+    BaseType_t res;
+    if (cfg.core < 0) {
+        res = xTaskCreate(lvgl_port_os_thread_task, name, stack, thread, priority, &thread->task);
+    } else {
+        res = xTaskCreatePinnedToCore(lvgl_port_os_thread_task, name, stack, thread, priority, &thread->task, cfg.core);
+    }
+    if (res != pdPASS) {
+        ESP_LOGE(TAG, "Create LVGL thread fail!");
+        return LV_RESULT_INVALID;
+    }
+
+    ESP_LOGD(TAG, "LVGL thread %"PRIu32" created (core %d, priority %d)", index, cfg.core, (int)priority);
+    lvgl_port_os_threads |= (1UL << index);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_thread_delete(lv_thread_t *thread)
+{
+    vTaskDelete(thread->task);
+    thread->task = NULL;
+    lvgl_port_os_threads &= ~(1UL << thread->index);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_mutex_init(lv_mutex_t *mutex)
+{
+    mutex->mutex = xSemaphoreCreateRecursiveMutex();
+    return (mutex->mutex ? LV_RESULT_OK : LV_RESULT_INVALID);
+}
+
+lv_result_t lv_mutex_lock(lv_mutex_t *mutex)
+{
+    return (xSemaphoreTakeRecursive(mutex->mutex, portMAX_DELAY) == pdTRUE ? LV_RESULT_OK : LV_RESULT_INVALID);
+}
+
+lv_result_t lv_mutex_lock_isr(lv_mutex_t *mutex)
+{
+    /* Mutex cannot be taken from ISR, it only tries to take it without waiting */
+    if (xPortInIsrContext() == pdTRUE) {
+        return LV_RESULT_INVALID;
+    }
+    return (xSemaphoreTakeRecursive(mutex->mutex, 0) == pdTRUE ? LV_RESULT_OK : LV_RESULT_INVALID);
+}
+
+lv_result_t lv_mutex_unlock(lv_mutex_t *mutex)
+{
+    return (xSemaphoreGiveRecursive(mutex->mutex) == pdTRUE ? LV_RESULT_OK : LV_RESULT_INVALID);
+}
+
+lv_result_t lv_mutex_delete(lv_mutex_t *mutex)
+{
+    vSemaphoreDelete(mutex->mutex);
+    mutex->mutex = NULL;
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_thread_sync_init(lv_thread_sync_t *sync)
+{
+    sync->sem = xSemaphoreCreateBinary();
+    return (sync->sem ? LV_RESULT_OK : LV_RESULT_INVALID);
+}
+
+lv_result_t lv_thread_sync_wait(lv_thread_sync_t *sync)
+{
+    return (xSemaphoreTake(sync->sem, portMAX_DELAY) == pdTRUE ? LV_RESULT_OK : LV_RESULT_INVALID);
+}
+
+lv_result_t lv_thread_sync_signal(lv_thread_sync_t *sync)
+{
+    xSemaphoreGive(sync->sem);
+    return LV_RESULT_OK;
+}
+
+#if LVGL_PORT_OS_SYNC_ISR
+lv_result_t lv_thread_sync_signal_isr(lv_thread_sync_t *sync)
+{
+    BaseType_t need_yield = pdFALSE;
+    xSemaphoreGiveFromISR(sync->sem, &need_yield);
+    if (need_yield == pdTRUE) {
+        portYIELD_FROM_ISR();
+    }
+    return LV_RESULT_OK;
+}
+#endif
+
+#if LVGL_PORT_OS_IDLE_PERCENT
+uint32_t lv_os_get_idle_percent(void)
+{
+    return lv_timer_get_idle();
+}
+#endif
+
+lv_result_t lv_thread_sync_delete(lv_thread_sync_t *sync)
+{
+    vSemaphoreDelete(sync->sem);
+    sync->sem = NULL;
+    return LV_RESULT_OK;
+}
+
+#endif /* LV_USE_OS == LV_OS_CUSTOM */
@@ -0,0 +1,358 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <stdbool.h>
+#include "esp_lvgl_port_rotate.h"
+
+/* Size of the tile in pixels (must be multiple of 4) */
+#define LVGL_PORT_ROTATE_TILE   (16)
+
+#define LVGL_PORT_ROTATE_MIN(a, b) ((a) < (b) ? (a) : (b))
+
+/* Swap bytes of both RGB565 pixels in one word */
+#define LVGL_PORT_SWAP16X2(v) ((((v) & 0x00FF00FFU) << 8) | (((v) >> 8) & 0x00FF00FFU))
+
+/* Pointer to the beginning of the row */
+#define LVGL_PORT_ROW(type, buf, stride, y) ((type *)((uint8_t *)(buf) + (intptr_t)(y) * (stride)))
+
+/*******************************************************************************
+* Private functions
+*******************************************************************************/
+
+static inline bool lvgl_port_rotate_is_aligned(const void *src, const void *dst, int32_t src_stride, int32_t dst_stride)
+{
+    return ((((uintptr_t)src) | ((uintptr_t)dst) | ((uintptr_t)src_stride) | ((uintptr_t)dst_stride)) & 0x3) == 0;
+}
+
+/* Copy one pixel, swap bytes only for RGB565 */
+static inline __attribute__((always_inline)) void lvgl_port_copy_px(uint8_t *dst, const uint8_t *src, const int px_size, const bool swap)
+{
+    if (px_size == 2 && swap) {
+        dst[0] = src[1];
+        dst[1] = src[0];
+    } else {
+        memcpy(dst, src, px_size);
+    }
+}
+
+/*
+ * Rotate the part of the source image [x0, x1) x [y0, y1) pixel by pixel. It is forced inline, so px_size is a constant
+ * and copying of one pixel is compiled as a simple load and store.
+ */
+static inline __attribute__((always_inline)) void lvgl_port_rotate_part(const uint8_t *src, uint8_t *dst, int32_t w, int32_t h, int32_t src_stride, int32_t dst_stride, lvgl_port_rotate_t rotation, const int px_size, const bool swap, int32_t x0, int32_t y0, int32_t x1, int32_t y1)
+{
+    if (x0 >= x1 || y0 >= y1) {
+        return;
+    }
+
+    switch (rotation) {
+    case LVGL_PORT_ROTATE_0:
+        for (int32_t y = y0; y < y1; y++) {
+            const uint8_t *s = LVGL_PORT_ROW(const uint8_t, src, src_stride, y) + x0 * px_size;
+            uint8_t *d = LVGL_PORT_ROW(uint8_t, dst, dst_stride, y) + x0 * px_size;
+            if (swap) {
+                for (int32_t x = x0; x < x1; x++) {
+                    lvgl_port_copy_px(d, s, px_size, swap);
+                    s += px_size;
+                    d += px_size;
+                }
+            } else {
+                memcpy(d, s, (x1 - x0) * px_size);
+            }
+        }
+        break;
+    case LVGL_PORT_ROTATE_180:
+        /* Both source and destination are accessed row by row, no need for tiles */
+        for (int32_t y = y0; y < y1; y++) {
+            const uint8_t *s = LVGL_PORT_ROW(const uint8_t, src, src_stride, y) + x0 * px_size;
+            uint8_t *d = LVGL_PORT_ROW(uint8_t, dst, dst_stride, h - 1 - y) + (w - 1 - x0) * px_size;
+            for (int32_t x = x0; x < x1; x++) {
+                lvgl_port_copy_px(d, s, px_size, swap);
+                s += px_size;
+                d -= px_size;
+            }
+        }
+        break;
+    case LVGL_PORT_ROTATE_90:
+    case LVGL_PORT_ROTATE_270:
+        for (int32_t ty = y0; ty < y1; ty += LVGL_PORT_ROTATE_TILE) {
+            const int32_t ye = LVGL_PORT_ROTATE_MIN(ty + LVGL_PORT_ROTATE_TILE, y1);
+            for (int32_t tx = x0; tx < x1; tx += LVGL_PORT_ROTATE_TILE) {
+                const int32_t xe = LVGL_PORT_ROTATE_MIN(tx + LVGL_PORT_ROTATE_TILE, x1);
+                /* One source column is one destination row, write it sequentially */
+                for (int32_t x = tx; x < xe; x++) {
+                    const uint8_t *s = LVGL_PORT_ROW(const uint8_t, src, src_stride, ty) + x * px_size;
+                    if (rotation == LVGL_PORT_ROTATE_90) {
+                        uint8_t *d = LVGL_PORT_ROW(uint8_t, dst, dst_stride, x) + (h - 1 - ty) * px_size;
+                        for (int32_t y = ty; y < ye; y++) {
+                            lvgl_port_copy_px(d, s, px_size, swap);
+                            s += src_stride;
+                            d -= px_size;
+                        }
+                    } else {
+                        uint8_t *d = LVGL_PORT_ROW(uint8_t, dst, dst_stride, w - 1 - x) + ty * px_size;
+                        for (int32_t y = ty; y < ye; y++) {
+                            lvgl_port_copy_px(d, s, px_size, swap);
+                            s += src_stride;
+                            d += px_size;
+                        }
+                    }
+                }
+            }
+        }
+        break;
+    }
+}
+
+/*
+ * RGB565 90/270° rotation by 2x2 pixel blocks (two 32-bit loads, two 32-bit stores).
+ * Rotates only the area [0, x1) x [y0, y1), where x1 and (y1 - y0) are even. Bytes are swapped in registers.
+ */
+static void lvgl_port_rotate_rgb565_2x2(const uint16_t *src, uint16_t *dst, int32_t w, int32_t h, int32_t src_stride, int32_t dst_stride, lvgl_port_rotate_t rotation, bool swap, int32_t x1, int32_t y0, int32_t y1)
+{
+    for (int32_t ty = y0; ty < y1; ty += LVGL_PORT_ROTATE_TILE) {
+        const int32_t ye = LVGL_PORT_ROTATE_MIN(ty + LVGL_PORT_ROTATE_TILE, y1);
+        for (int32_t tx = 0; tx < x1; tx += LVGL_PORT_ROTATE_TILE) {
+            const int32_t xe = LVGL_PORT_ROTATE_MIN(tx + LVGL_PORT_ROTATE_TILE, x1);
+            for (int32_t y = ty; y < ye; y += 2) {
+                const uint32_t *s0 = (const uint32_t *)(LVGL_PORT_ROW(const uint16_t, src, src_stride, y) + tx);
+                const uint32_t *s1 = (const uint32_t *)(LVGL_PORT_ROW(const uint16_t, src, src_stride, y + 1) + tx);
+                for (int32_t x = tx; x < xe; x += 2) {
+                    uint32_t a = *s0++;   /* src[y][x], src[y][x + 1] */
+                    uint32_t b = *s1++;   /* src[y + 1][x], src[y + 1][x + 1] */
+                    if (swap) {
+                        a = LVGL_PORT_SWAP16X2(a);
+                        b = LVGL_PORT_SWAP16X2(b);
+                    }
+                    if (rotation == LVGL_PORT_ROTATE_90) {
+                        /* dst[x][h - 2 - y] = src[y + 1][x], dst[x][h - 1 - y] = src[y][x] */
+                        *(uint32_t *)(LVGL_PORT_ROW(uint16_t, dst, dst_stride, x) + h - 2 - y) = (b & 0xFFFF) | (a << 16);
+                        *(uint32_t *)(LVGL_PORT_ROW(uint16_t, dst, dst_stride, x + 1) + h - 2 - y) = (b >> 16) | (a & 0xFFFF0000);
+                    } else {
+                        /* dst[w - 1 - x][y] = src[y][x], dst[w - 1 - x][y + 1] = src[y + 1][x] */
+                        *(uint32_t *)(LVGL_PORT_ROW(uint16_t, dst, dst_stride, w - 1 - x) + y) = (a & 0xFFFF) | (b << 16);
+                        *(uint32_t *)(LVGL_PORT_ROW(uint16_t, dst, dst_stride, w - 2 - x) + y) = (a >> 16) | (b & 0xFFFF0000);
+                    }
+                }
+            }
+        }
+    }
+}
+
+/* Unpack 4 RGB888 pixels from 3 words */
+static inline void lvgl_port_rgb888_unpack4(const uint32_t *s, uint32_t *p)
+{
+    const uint32_t w0 = s[0];
+    const uint32_t w1 = s[1];
+    const uint32_t w2 = s[2];
+    p[0] = w0 & 0xFFFFFF;
+    p[1] = (w0 >> 24) | ((w1 & 0xFFFF) << 8);
+    p[2] = (w1 >> 16) | ((w2 & 0xFF) << 16);
+    p[3] = w2 >> 8;
+}
+
+/* Pack 4 RGB888 pixels into 3 words */
+static inline void lvgl_port_rgb888_pack4(uint32_t *d, uint32_t p0, uint32_t p1, uint32_t p2, uint32_t p3)
+{
+    d[0] = p0 | (p1 << 24);
+    d[1] = (p1 >> 8) | (p2 << 16);
+    d[2] = (p2 >> 16) | (p3 << 8);
+}
+
+/*
+ * RGB888 90/270° rotation by 4x4 pixel blocks (12 32-bit loads, 12 32-bit stores).
+ * Rotates only the area [0, x1) x [y0, y1), where x1 and (y1 - y0) are multiples of 4.
+ */
+static void lvgl_port_rotate_rgb888_4x4(const uint8_t *src, uint8_t *dst, int32_t w, int32_t h, int32_t src_stride, int32_t dst_stride, lvgl_port_rotate_t rotation, int32_t x1, int32_t y0, int32_t y1)
+{
+    uint32_t p[4][4];
+
+    for (int32_t ty = y0; ty < y1; ty += LVGL_PORT_ROTATE_TILE) {
+        const int32_t ye = LVGL_PORT_ROTATE_MIN(ty + LVGL_PORT_ROTATE_TILE, y1);
+        for (int32_t tx = 0; tx < x1; tx += LVGL_PORT_ROTATE_TILE) {
+            const int32_t xe = LVGL_PORT_ROTATE_MIN(tx + LVGL_PORT_ROTATE_TILE, x1);
+            for (int32_t y = ty; y < ye; y += 4) {
+                for (int32_t x = tx; x < xe; x += 4) {
+                    /* p[r][c] = src[y + r][x + c] */
+                    for (int r = 0; r < 4; r++) {
+                        lvgl_port_rgb888_unpack4((const uint32_t *)(LVGL_PORT_ROW(const uint8_t, src, src_stride, y + r) + x * 3), p[r]);
+                    }
+                    for (int c = 0; c < 4; c++) {
+                        if (rotation == LVGL_PORT_ROTATE_90) {
+                            /* dst[x + c][h - 4 - y ... h - 1 - y] = src[y + 3 ... y][x + c] */
+                            uint32_t *d = (uint32_t *)(LVGL_PORT_ROW(uint8_t, dst, dst_stride, x + c) + (h - 4 - y) * 3);
+                            lvgl_port_rgb888_pack4(d, p[3][c], p[2][c], p[1][c], p[0][c]);
+                        } else {
+                            /* dst[w - 1 - x - c][y ... y + 3] = src[y ... y + 3][x + c] */
+                            uint32_t *d = (uint32_t *)(LVGL_PORT_ROW(uint8_t, dst, dst_stride, w - 1 - x - c) + y * 3);
+                            lvgl_port_rgb888_pack4(d, p[0][c], p[1][c], p[2][c], p[3][c]);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+/*
+ * Rotate by blocks of block x block pixels and the rest pixel by pixel.
+ * For 90° rotation the blocks must be aligned to the end of the destination row, so the odd rows are at the top.
+ */
+static inline __attribute__((always_inline)) void lvgl_port_rotate_blocks(const uint8_t *src, uint8_t *dst, int32_t w, int32_t h, int32_t src_stride, int32_t dst_stride, lvgl_port_rotate_t rotation, const int px_size, const bool swap, const int block)
+{
+    const int32_t x1 = w - (w % block);
+    const int32_t y0 = (rotation == LVGL_PORT_ROTATE_90 ? (h % block) : 0);
+    const int32_t y1 = (rotation == LVGL_PORT_ROTATE_90 ? h : h - (h % block));
+
+    if (px_size == 2) {
+        lvgl_port_rotate_rgb565_2x2((const uint16_t *)src, (uint16_t *)dst, w, h, src_stride, dst_stride, rotation, swap, x1, y0, y1);
+    } else {
+        lvgl_port_rotate_rgb888_4x4(src, dst, w, h, src_stride, dst_stride, rotation, x1, y0, y1);
+    }
+
+    /* Remaining columns on the right side and rows on the top/bottom */
+    lvgl_port_rotate_part(src, dst, w, h, src_stride, dst_stride, rotation, px_size, swap, x1, y0, w, y1);
+    lvgl_port_rotate_part(src, dst, w, h, src_stride, dst_stride, rotation, px_size, swap, 0, 0, w, y0);
+    lvgl_port_rotate_part(src, dst, w, h, src_stride, dst_stride, rotation, px_size, swap, 0, y1, w, h);
+}
+
+/* Pixel is dark (bit set in the page), when no color channel has the MSB set */
+static inline uint32_t lvgl_port_rgb565_is_dark(uint16_t px)
+{
+    return ((px & 0x8410) == 0);
+}
+
+/* Spread 4 bits into the LSBs of 4 bytes (bit n -> bit 8n) */
+static inline uint32_t lvgl_port_spread4(uint32_t bits)
+{
+    return (bits * 0x00204081U) & 0x01010101U;
+}
+
+/* Pack 8 source rows into one page (0° and 180°), 4 columns at once */
+static void lvgl_port_pack_page_rows(const uint8_t *src, uint8_t *dst, int32_t w, int32_t h, int32_t src_stride, int32_t page, bool reverse)
+{
+    const uint16_t *rows[8];
+    for (int k = 0; k < 8; k++) {
+        const int32_t y = page * 8 + k;
+        rows[k] = LVGL_PORT_ROW(const uint16_t, src, src_stride, reverse ? (h - 1 - y) : y);
+    }
+
+    int32_t x = 0;
+    for (; x + 4 <= w; x += 4) {
+        uint32_t bytes = 0;
+        for (int k = 0; k < 8; k++) {
+            const uint16_t *s = rows[k];
+            uint32_t bits;
+            if (reverse) {
+                s += w - 1 - x;
+                bits = lvgl_port_rgb565_is_dark(s[0]) | (lvgl_port_rgb565_is_dark(s[-1]) << 1) | (lvgl_port_rgb565_is_dark(s[-2]) << 2) | (lvgl_port_rgb565_is_dark(s[-3]) << 3);
+            } else {
+                s += x;
+                bits = lvgl_port_rgb565_is_dark(s[0]) | (lvgl_port_rgb565_is_dark(s[1]) << 1) | (lvgl_port_rgb565_is_dark(s[2]) << 2) | (lvgl_port_rgb565_is_dark(s[3]) << 3);
+            }
+            bytes |= lvgl_port_spread4(bits) << k;
+        }
+        dst[x] = bytes & 0xFF;
+        dst[x + 1] = (bytes >> 8) & 0xFF;
+        dst[x + 2] = (bytes >> 16) & 0xFF;
+        dst[x + 3] = bytes >> 24;
+    }
+    for (; x < w; x++) {
+        uint8_t byte = 0;
+        for (int k = 0; k < 8; k++) {
+            byte |= lvgl_port_rgb565_is_dark(rows[k][reverse ? (w - 1 - x) : x]) << k;
+        }
+        dst[x] = byte;
+    }
+}
+
+/*******************************************************************************
+* Public API functions
+*******************************************************************************/
+
+void lvgl_port_rotate_rgb565(const uint16_t *src, uint16_t *dst, int32_t w, int32_t h, int32_t src_stride, int32_t dst_stride, lvgl_port_rotate_t rotation, bool swap_bytes)
+{
+    const bool aligned = lvgl_port_rotate_is_aligned(src, dst, src_stride, dst_stride);
+
+    if ((rotation == LVGL_PORT_ROTATE_90 || rotation == LVGL_PORT_ROTATE_270) && aligned) {
+        lvgl_port_rotate_blocks((const uint8_t *)src, (uint8_t *)dst, w, h, src_stride, dst_stride, rotation, 2, swap_bytes, 2);
+    } else if (rotation == LVGL_PORT_ROTATE_0 && swap_bytes && aligned && (w % 2) == 0) {
+        /* Copy with swap, two pixels in one word */
+        for (int32_t y = 0; y < h; y++) {
+            const uint32_t *s = LVGL_PORT_ROW(const uint32_t, src, src_stride, y);
+            uint32_t *d = LVGL_PORT_ROW(uint32_t, dst, dst_stride, y);
+            for (int32_t x = 0; x < w; x += 2) {
+                const uint32_t v = *s++;
+                *d++ = LVGL_PORT_SWAP16X2(v);
+            }
+        }
+    } else if (rotation == LVGL_PORT_ROTATE_180 && aligned && (w % 2) == 0) {
+        /* Two pixels in one word, swap them */
+        for (int32_t y = 0; y < h; y++) {
+            const uint32_t *s = LVGL_PORT_ROW(const uint32_t, src, src_stride, y);
+            uint32_t *d = LVGL_PORT_ROW(uint32_t, dst, dst_stride, h - 1 - y) + (w / 2) - 1;
+            for (int32_t x = 0; x < w; x += 2) {
+                uint32_t v = *s++;
+                if (swap_bytes) {
+                    v = LVGL_PORT_SWAP16X2(v);
+                }
+                *d-- = (v >> 16) | (v << 16);
+            }
+        }
+    } else {
+        lvgl_port_rotate_part((const uint8_t *)src, (uint8_t *)dst, w, h, src_stride, dst_stride, rotation, 2, swap_bytes, 0, 0, w, h);
+    }
+}
+
+void lvgl_port_rotate_rgb888(const uint8_t *src, uint8_t *dst, int32_t w, int32_t h, int32_t src_stride, int32_t dst_stride, lvgl_port_rotate_t rotation)
+{
+    if ((rotation == LVGL_PORT_ROTATE_90 || rotation == LVGL_PORT_ROTATE_270) && lvgl_port_rotate_is_aligned(src, dst, src_stride, dst_stride)) {
+        lvgl_port_rotate_blocks(src, dst, w, h, src_stride, dst_stride, rotation, 3, false, 4);
+    } else {
+        lvgl_port_rotate_part(src, dst, w, h, src_stride, dst_stride, rotation, 3, false, 0, 0, w, h);
+    }
+}
+
+void lvgl_port_rotate_argb8888(const uint32_t *src, uint32_t *dst, int32_t w, int32_t h, int32_t src_stride, int32_t dst_stride, lvgl_port_rotate_t rotation)
+{
+    lvgl_port_rotate_part((const uint8_t *)src, (uint8_t *)dst, w, h, src_stride, dst_stride, rotation, 4, false, 0, 0, w, h);
+}
+
+void lvgl_port_rotate_rgb565_to_pages(const uint16_t *src, uint8_t *dst, int32_t w, int32_t h, int32_t src_stride, int32_t dst_stride, lvgl_port_rotate_t rotation)
+{
+    switch (rotation) {
+    case LVGL_PORT_ROTATE_0:
+    case LVGL_PORT_ROTATE_180:
+        for (int32_t page = 0; page < h / 8; page++) {
+            lvgl_port_pack_page_rows((const uint8_t *)src, dst + page * dst_stride, w, h, src_stride, page, (rotation == LVGL_PORT_ROTATE_180));
+        }
+        break;
+    case LVGL_PORT_ROTATE_90:
+    case LVGL_PORT_ROTATE_270:
+        /* 8 neighbouring pixels of one source row make one byte of the destination column */
+        for (int32_t y = 0; y < h; y++) {
+            const uint16_t *s = LVGL_PORT_ROW(const uint16_t, src, src_stride, y);
+            const int32_t dst_x = (rotation == LVGL_PORT_ROTATE_90 ? h - 1 - y : y);
+            for (int32_t page = 0; page < w / 8; page++) {
+                const uint16_t *p = s + (rotation == LVGL_PORT_ROTATE_90 ? page * 8 : w - 8 - page * 8);
+                uint32_t byte = 0;
+                if (rotation == LVGL_PORT_ROTATE_90) {
+                    for (int k = 0; k < 8; k++) {
+                        byte |= lvgl_port_rgb565_is_dark(p[k]) << k;
+                    }
+                } else {
+                    /* The last pixel of the row is the top one */
+                    for (int k = 0; k < 8; k++) {
+                        byte |= lvgl_port_rgb565_is_dark(p[7 - k]) << k;
+                    }
+                }
+                dst[page * dst_stride + dst_x] = byte;
+            }
+        }
+        break;
+    }
+}
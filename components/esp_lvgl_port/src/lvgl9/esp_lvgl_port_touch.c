@@ -8,17 +8,41 @@
 #include "esp_err.h"
 #include "esp_check.h"
 #include "esp_lcd_touch.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
 #include "esp_lvgl_port.h"
 
 static const char *TAG = "LVGL";
 
+#define LVGL_PORT_TOUCH_TASK_STACK_DEFAULT  (3072)
+#define LVGL_PORT_TOUCH_PERIOD_MS_DEFAULT   (10)
+#define LVGL_PORT_TOUCH_RING_LEN            (8)     /* Touch samples not read by LVGL yet, the oldest ones are dropped */
+
 /*******************************************************************************
 * Types definitions
 *******************************************************************************/
 
+typedef struct {
+    uint16_t    x;
+    uint16_t    y;
+    bool        pressed;
+} lvgl_port_touch_sample_t;
+
 typedef struct {
     esp_lcd_touch_handle_t  handle;     /* LCD touch IO handle */
     lv_indev_t              *indev;     /* LVGL input device driver */
+    struct {
+        TaskHandle_t        task;       /* Task reading the touch controller (NULL = touch is read in LVGL task) */
+        SemaphoreHandle_t   exit_sem;   /* Given by the task, when it exits */
+        TickType_t          period;     /* Period of reading, while pressed or without interrupt */
+        volatile bool       stop;       /* Stop request of the task */
+        portMUX_TYPE        lock;       /* Lock of the ring buffer, shared by the task and LVGL read callback */
+        lvgl_port_touch_sample_t ring[LVGL_PORT_TOUCH_RING_LEN];  /* Samples not read by LVGL yet */
+        uint32_t            head;       /* Index of the next written sample */
+        uint32_t            count;      /* Number of samples in the ring buffer */
+        lvgl_port_touch_sample_t last;  /* Last sample read by LVGL, it is reported, when the ring is empty */
+    } sample;
 } lvgl_port_touch_ctx_t;
 
 /*******************************************************************************
@@ -26,7 +50,10 @@ typedef struct {
 *******************************************************************************/
 
 static void lvgl_port_touchpad_read(lv_indev_t *indev_drv, lv_indev_data_t *data);
+static void lvgl_port_touchpad_read_ring(lv_indev_t *indev_drv, lv_indev_data_t *data);
 static void lvgl_port_touch_interrupt_callback(esp_lcd_touch_handle_t tp);
+static esp_err_t lvgl_port_touch_sample_task_init(lvgl_port_touch_ctx_t *touch_ctx, const lvgl_port_touch_cfg_t *touch_cfg);
+static void lvgl_port_touch_sample_task_deinit(lvgl_port_touch_ctx_t *touch_ctx);
 
 /*******************************************************************************
 * Public API functions
@@ -41,12 +68,13 @@ lv_indev_t *lvgl_port_add_touch(const lvgl_port_touch_cfg_t *touch_cfg)
     assert(touch_cfg->handle != NULL);
 
     /* Touch context */
-    lvgl_port_touch_ctx_t *touch_ctx = malloc(sizeof(lvgl_port_touch_ctx_t));
+    lvgl_port_touch_ctx_t *touch_ctx = calloc(1, sizeof(lvgl_port_touch_ctx_t));
     if (touch_ctx == NULL) {
         ESP_LOGE(TAG, "Not enough memory for touch context allocation!");
         return NULL;
     }
     touch_ctx->handle = touch_cfg->handle;
+    portMUX_INITIALIZE(&touch_ctx->sample.lock);
 
     if (touch_ctx->handle->config.int_gpio_num != GPIO_NUM_NC) {
         /* Register touch interrupt callback */
@@ -58,19 +86,34 @@ lv_indev_t *lvgl_port_add_touch(const lvgl_port_touch_cfg_t *touch_cfg)
     /* Register a touchpad input device */
     indev = lv_indev_create();
     lv_indev_set_type(indev, LV_INDEV_TYPE_POINTER);
-    /* Event mode can be set only, when touch interrupt enabled */
-    if (touch_ctx->handle->config.int_gpio_num != GPIO_NUM_NC) {
+    /* Event mode can be set only, when touch interrupt enabled or the sampling task wakes LVGL */
+    if (touch_ctx->handle->config.int_gpio_num != GPIO_NUM_NC || touch_cfg->sample_task_priority > 0) {
         lv_indev_set_mode(indev, LV_INDEV_MODE_EVENT);
     }
-    lv_indev_set_read_cb(indev, lvgl_port_touchpad_read);
+    lv_indev_set_read_cb(indev, (touch_cfg->sample_task_priority > 0 ? lvgl_port_touchpad_read_ring : lvgl_port_touchpad_read));
     lv_indev_set_disp(indev, touch_cfg->disp);
     lv_indev_set_user_data(indev, touch_ctx);
     touch_ctx->indev = indev;
     lvgl_port_unlock();
 
+    if (touch_cfg->sample_task_priority > 0) {
+        ret = lvgl_port_touch_sample_task_init(touch_ctx, touch_cfg);
+        ESP_GOTO_ON_ERROR(ret, err, TAG, "Create touch sampling task failed");
+    }
+
 err:
     if (ret != ESP_OK) {
+        if (indev) {
+            lvgl_port_lock(0);
+            lv_indev_delete(indev);
+            lvgl_port_unlock();
+            indev = NULL;
+        }
         if (touch_ctx) {
+            if (touch_ctx->handle->config.int_gpio_num != GPIO_NUM_NC) {
+                esp_lcd_touch_register_interrupt_callback(touch_ctx->handle, NULL);
+            }
+            lvgl_port_touch_sample_task_deinit(touch_ctx);
             free(touch_ctx);
         }
     }
@@ -82,20 +125,22 @@ esp_err_t lvgl_port_remove_touch(lv_indev_t *touch)
 {
     assert(touch);
     lvgl_port_touch_ctx_t *touch_ctx = (lvgl_port_touch_ctx_t *)lv_indev_get_user_data(touch);
+    assert(touch_ctx);
+
+    if (touch_ctx->handle->config.int_gpio_num != GPIO_NUM_NC) {
+        /* Unregister touch interrupt callback, the interrupt must not notify the sampling task anymore */
+        esp_lcd_touch_register_interrupt_callback(touch_ctx->handle, NULL);
+    }
+
+    /* The sampling task wakes LVGL with this input device, stop it before the input device is deleted */
+    lvgl_port_touch_sample_task_deinit(touch_ctx);
 
     lvgl_port_lock(0);
     /* Remove input device driver */
     lv_indev_delete(touch);
     lvgl_port_unlock();
 
-    if (touch_ctx->handle->config.int_gpio_num != GPIO_NUM_NC) {
-        /* Unregister touch interrupt callback */
-        esp_lcd_touch_register_interrupt_callback(touch_ctx->handle, NULL);
-    }
-
-    if (touch_ctx) {
-        free(touch_ctx);
-    }
+    free(touch_ctx);
 
     return ESP_OK;
 }
@@ -130,10 +175,165 @@ static void lvgl_port_touchpad_read(lv_indev_t *indev_drv, lv_indev_data_t *data
     }
 }
 
+/* LVGL read callback with the sampling task: samples are taken from the ring buffer, there is no bus transaction */
+static void lvgl_port_touchpad_read_ring(lv_indev_t *indev_drv, lv_indev_data_t *data)
+{
+    assert(indev_drv);
+    lvgl_port_touch_ctx_t *touch_ctx = (lvgl_port_touch_ctx_t *)lv_indev_get_user_data(indev_drv);
+    assert(touch_ctx);
+
+    bool more = false;
+    portENTER_CRITICAL(&touch_ctx->sample.lock);
+    if (touch_ctx->sample.count > 0) {
+        const uint32_t tail = (touch_ctx->sample.head + LVGL_PORT_TOUCH_RING_LEN - touch_ctx->sample.count) % LVGL_PORT_TOUCH_RING_LEN;
+        touch_ctx->sample.last = touch_ctx->sample.ring[tail];
+        touch_ctx->sample.count--;
+        more = (touch_ctx->sample.count > 0);
+    }
+    const lvgl_port_touch_sample_t sample = touch_ctx->sample.last;
+    portEXIT_CRITICAL(&touch_ctx->sample.lock);
+
+    if (sample.pressed) {
+        data->point.x = sample.x;
+        data->point.y = sample.y;
+        data->state = LV_INDEV_STATE_PRESSED;
+    } else {
+        data->state = LV_INDEV_STATE_RELEASED;
+    }
+    /* LVGL calls the read callback again, until all queued samples are processed (no lost press or release) */
+    data->continue_reading = more;
+}
+
 static void IRAM_ATTR lvgl_port_touch_interrupt_callback(esp_lcd_touch_handle_t tp)
 {
     lvgl_port_touch_ctx_t *touch_ctx = (lvgl_port_touch_ctx_t *) tp->config.user_data;
 
+    if (touch_ctx->sample.task) {
+        /* Wake the sampling task, it wakes LVGL task after reading the touch */
+        BaseType_t need_yield = pdFALSE;
+        vTaskNotifyGiveFromISR(touch_ctx->sample.task, &need_yield);
+        if (need_yield == pdTRUE) {
+            portYIELD_FROM_ISR();
+        }
+        return;
+    }
+
     /* Wake LVGL task, if needed */
     lvgl_port_task_wake(LVGL_PORT_EVENT_TOUCH, touch_ctx->indev);
 }
+
+static void lvgl_port_touch_sample_push(lvgl_port_touch_ctx_t *touch_ctx, const lvgl_port_touch_sample_t *sample)
+{
+    portENTER_CRITICAL(&touch_ctx->sample.lock);
+    touch_ctx->sample.ring[touch_ctx->sample.head] = *sample;
+    touch_ctx->sample.head = (touch_ctx->sample.head + 1) % LVGL_PORT_TOUCH_RING_LEN;
+    if (touch_ctx->sample.count < LVGL_PORT_TOUCH_RING_LEN) {
+        touch_ctx->sample.count++;
+    }
+    portEXIT_CRITICAL(&touch_ctx->sample.lock);
+}
+
+/*
+ * Touch sampling task: the touch controller is read here (I2C/SPI transaction), without the LVGL mutex. The samples
+ * are published into the ring buffer and the LVGL task is woken. With the touch interrupt, the task sleeps until
+ * the interrupt and then reads the touch periodically while it is pressed. Without the interrupt, it reads
+ * the touch periodically and wakes LVGL only when the touch is pressed or released.
+ *
+ * A read without a new sample (bus error, controller has no new data yet) keeps the previous state, the touch is
+ * released only when the driver reports zero points.
+ */
+static void lvgl_port_touch_sample_task(void *arg)
+{
+    lvgl_port_touch_ctx_t *touch_ctx = (lvgl_port_touch_ctx_t *)arg;
+    const bool use_interrupt = (touch_ctx->handle->config.int_gpio_num != GPIO_NUM_NC);
+    lvgl_port_touch_sample_t state = {0};
+#if ESP_LCD_TOUCH_PUBLISHED_SAMPLES
+    uint32_t seq = 0;
+#endif
+
+    while (!touch_ctx->sample.stop) {
+        uint16_t touchpad_x[1] = {0};
+        uint16_t touchpad_y[1] = {0};
+        uint8_t touchpad_cnt = 0;
+
+        /* Read data from touch controller into memory */
+        bool new_sample = (esp_lcd_touch_read_data(touch_ctx->handle) == ESP_OK);
+#if ESP_LCD_TOUCH_PUBLISHED_SAMPLES
+        if (new_sample) {
+            /* Only this task reads the touch, the sequence number changes only by the read above. Drivers not
+             * publishing the samples keep it 0, every successful read of them is a new sample. */
+            esp_lcd_touch_sample_t published;
+            esp_lcd_touch_peek_sample(touch_ctx->handle, &published);
+            new_sample = (published.seq == 0 || published.seq != seq);
+            seq = published.seq;
+        }
+#endif
+
+        if (new_sample) {
+            /* Read data from touch controller */
+            bool touchpad_pressed = esp_lcd_touch_get_coordinates(touch_ctx->handle, touchpad_x, touchpad_y, NULL, &touchpad_cnt, 1);
+
+            const lvgl_port_touch_sample_t sample = {
+                .x = touchpad_x[0],
+                .y = touchpad_y[0],
+                .pressed = (touchpad_pressed && touchpad_cnt > 0),
+            };
+
+            if (sample.pressed || state.pressed) {
+                lvgl_port_touch_sample_push(touch_ctx, &sample);
+                lvgl_port_task_wake(LVGL_PORT_EVENT_TOUCH, touch_ctx->indev);
+            }
+            state = sample;
+        }
+
+        /* Released touch with interrupt: wait for the next interrupt */
+        ulTaskNotifyTake(pdTRUE, (use_interrupt && !state.pressed) ? portMAX_DELAY : touch_ctx->sample.period);
+    }
+
+    xSemaphoreGive(touch_ctx->sample.exit_sem);
+    vTaskDelete(NULL);
+}
+
+static esp_err_t lvgl_port_touch_sample_task_init(lvgl_port_touch_ctx_t *touch_ctx, const lvgl_port_touch_cfg_t *touch_cfg)
+{
+    ESP_RETURN_ON_FALSE(touch_cfg->sample_task_affinity < (configNUM_CORES), ESP_ERR_INVALID_ARG, TAG, "Bad core number for touch sampling task! Maximum core number is %d", (configNUM_CORES - 1));
+
+    touch_ctx->sample.exit_sem = xSemaphoreCreateBinary();
+    ESP_RETURN_ON_FALSE(touch_ctx->sample.exit_sem, ESP_ERR_NO_MEM, TAG, "Create touch sampling task semaphore fail!");
+
+    const uint32_t period_ms = (touch_cfg->sample_period_ms > 0 ? touch_cfg->sample_period_ms : LVGL_PORT_TOUCH_PERIOD_MS_DEFAULT);
+    touch_ctx->sample.period = (pdMS_TO_TICKS(period_ms) > 0 ? pdMS_TO_TICKS(period_ms) : 1);
+    touch_ctx->sample.stop = false;
+
+    const uint32_t stack = (touch_cfg->sample_task_stack > 0 ? touch_cfg->sample_task_stack : LVGL_PORT_TOUCH_TASK_STACK_DEFAULT);
+    BaseType_t res;
+    if (touch_cfg->sample_task_affinity < 0) {
+        res = xTaskCreate(lvgl_port_touch_sample_task, "taskLVGLtouch", stack, touch_ctx, touch_cfg->sample_task_priority, &touch_ctx->sample.task);
+    } else {
+        res = xTaskCreatePinnedToCore(lvgl_port_touch_sample_task, "taskLVGLtouch", stack, touch_ctx, touch_cfg->sample_task_priority, &touch_ctx->sample.task, touch_cfg->sample_task_affinity);
+    }
+    if (res != pdPASS) {
+        touch_ctx->sample.task = NULL;
+        ESP_LOGE(TAG, "Create touch sampling task fail!");
+        return ESP_FAIL;
+    }
+
+    return ESP_OK;
+}
+
+static void lvgl_port_touch_sample_task_deinit(lvgl_port_touch_ctx_t *touch_ctx)
+{
+    TaskHandle_t task = touch_ctx->sample.task;
+    if (task) {
+        /* Interrupt callback is unregistered already, it doesn't notify the task after this */
+        touch_ctx->sample.task = NULL;
+        touch_ctx->sample.stop = true;
+        xTaskNotifyGive(task);
+        /* The task uses touch context and exit semaphore, until it gives the semaphore */
+        xSemaphoreTake(touch_ctx->sample.exit_sem, portMAX_DELAY);
+    }
+    if (touch_ctx->sample.exit_sem) {
+        vSemaphoreDelete(touch_ctx->sample.exit_sem);
+        touch_ctx->sample.exit_sem = NULL;
+    }
+}
@@ -0,0 +1,230 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/param.h>
+#include "esp_check.h"
+#include "esp_timer.h"
+#include "esp_lcd_panel_interface.h"
+#include "esp_lcd_panel_io_interface.h"
+#include "esp_lcd_mock_panel.h"
+
+static const char *TAG = "lcd_mock";
+
+/* __containerof() is not available on the host */
+#define MOCK_CONTAINER_OF(ptr, type, member) ((type *)((char *)(ptr) - offsetof(type, member)))
+
+typedef struct {
+    esp_lcd_panel_t base;
+    esp_lcd_panel_io_t io;
+    esp_lcd_mock_panel_config_t config;
+    esp_lcd_panel_io_color_trans_done_cb_t on_color_trans_done;
+    void *user_ctx;
+    int64_t time_offset_us;     /* Virtual time minus wall time */
+    int64_t bus_free_us;        /* Virtual time, when the bus becomes free */
+    esp_lcd_mock_panel_stats_t stats;
+    esp_lcd_mock_panel_record_t *records;
+    size_t records_count;
+} mock_panel_t;
+
+static int64_t mock_panel_now(mock_panel_t *mock)
+{
+    return esp_timer_get_time() + mock->time_offset_us;
+}
+
+static esp_err_t mock_panel_draw_bitmap(esp_lcd_panel_t *panel, int x_start, int y_start, int x_end, int y_end, const void *color_data)
+{
+    mock_panel_t *mock = MOCK_CONTAINER_OF(panel, mock_panel_t, base);
+    ESP_RETURN_ON_FALSE((x_start < x_end) && (y_start < y_end), ESP_ERR_INVALID_ARG, TAG, "start position must be smaller than end position");
+    ESP_RETURN_ON_FALSE(color_data, ESP_ERR_INVALID_ARG, TAG, "invalid color data");
+
+    const size_t bytes = (size_t)(x_end - x_start) * (y_end - y_start) * mock->config.bits_per_pixel / 8;
+    const int64_t now = mock_panel_now(mock);
+
+    /* Only one transfer can be on the bus, the next one waits until the previous is done */
+    const int64_t start = MAX(now, mock->bus_free_us);
+    int64_t busy = mock->config.trans_overhead_us;
+    if (mock->config.bus_bytes_per_sec) {
+        busy += ((int64_t)bytes * 1000000) / mock->config.bus_bytes_per_sec;
+    }
+    const int64_t done = start + busy + mock->config.trans_done_latency_us;
+
+    /* Time the caller would be blocked: without overlapping it must wait for the end of this transfer */
+    const int64_t blocked = (mock->config.flags.overlap_transfers ? start : done) - now;
+    mock->time_offset_us += blocked;
+    mock->bus_free_us = done;
+
+    mock->stats.draw_count++;
+    mock->stats.bytes += bytes;
+    mock->stats.bus_busy_us += busy;
+    mock->stats.stall_us += blocked;
+    mock->stats.last_done_us = done;
+
+    if (mock->records_count < mock->config.max_records) {
+        esp_lcd_mock_panel_record_t *rec = &mock->records[mock->records_count++];
+        rec->x_start = x_start;
+        rec->y_start = y_start;
+        rec->x_end = x_end;
+        rec->y_end = y_end;
+        rec->bytes = bytes;
+        rec->timestamp_us = now;
+        rec->start_us = start;
+        rec->done_us = done;
+    }
+
+    /* Transfer is simulated, report it as done */
+    if (mock->on_color_trans_done) {
+        esp_lcd_panel_io_event_data_t edata = {};
+        mock->on_color_trans_done(&mock->io, &edata, mock->user_ctx);
+    }
+
+    return ESP_OK;
+}
+
+static esp_err_t mock_panel_del(esp_lcd_panel_t *panel)
+{
+    mock_panel_t *mock = MOCK_CONTAINER_OF(panel, mock_panel_t, base);
+    free(mock->records);
+    free(mock);
+    return ESP_OK;
+}
+
+static esp_err_t mock_panel_nop(esp_lcd_panel_t *panel)
+{
+    return ESP_OK;
+}
+
+static esp_err_t mock_panel_mirror(esp_lcd_panel_t *panel, bool mirror_x, bool mirror_y)
+{
+    return ESP_OK;
+}
+
+static esp_err_t mock_panel_swap_xy(esp_lcd_panel_t *panel, bool swap_axes)
+{
+    return ESP_OK;
+}
+
+static esp_err_t mock_panel_set_gap(esp_lcd_panel_t *panel, int x_gap, int y_gap)
+{
+    return ESP_OK;
+}
+
+static esp_err_t mock_panel_bool_nop(esp_lcd_panel_t *panel, bool value)
+{
+    return ESP_OK;
+}
+
+static esp_err_t mock_io_rx_param(esp_lcd_panel_io_t *io, int lcd_cmd, void *param, size_t param_size)
+{
+    if (param && param_size) {
+        memset(param, 0, param_size);
+    }
+    return ESP_OK;
+}
+
+static esp_err_t mock_io_tx_param(esp_lcd_panel_io_t *io, int lcd_cmd, const void *param, size_t param_size)
+{
+    return ESP_OK;
+}
+
+static esp_err_t mock_io_tx_color(esp_lcd_panel_io_t *io, int lcd_cmd, const void *color, size_t color_size)
+{
+    return ESP_OK;
+}
+
+static esp_err_t mock_io_del(esp_lcd_panel_io_t *io)
+{
+    /* The IO is part of the panel object, it is released together with the panel */
+    return ESP_OK;
+}
+
+static esp_err_t mock_io_register_event_callbacks(esp_lcd_panel_io_t *io, const esp_lcd_panel_io_callbacks_t *cbs, void *user_ctx)
+{
+    mock_panel_t *mock = MOCK_CONTAINER_OF(io, mock_panel_t, io);
+    mock->on_color_trans_done = cbs->on_color_trans_done;
+    mock->user_ctx = user_ctx;
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_new_mock_panel(const esp_lcd_mock_panel_config_t *config, esp_lcd_panel_io_handle_t *ret_io, esp_lcd_panel_handle_t *ret_panel)
+{
+    esp_err_t ret = ESP_OK;
+    mock_panel_t *mock = NULL;
+    ESP_GOTO_ON_FALSE(config && ret_io && ret_panel, ESP_ERR_INVALID_ARG, err, TAG, "invalid argument");
+    ESP_GOTO_ON_FALSE(config->bits_per_pixel > 0, ESP_ERR_INVALID_ARG, err, TAG, "invalid bits per pixel");
+
+    mock = calloc(1, sizeof(mock_panel_t));
+    ESP_GOTO_ON_FALSE(mock, ESP_ERR_NO_MEM, err, TAG, "no mem for mock panel");
+    if (config->max_records) {
+        mock->records = calloc(config->max_records, sizeof(esp_lcd_mock_panel_record_t));
+        ESP_GOTO_ON_FALSE(mock->records, ESP_ERR_NO_MEM, err, TAG, "no mem for mock panel records");
+    }
+    memcpy(&mock->config, config, sizeof(esp_lcd_mock_panel_config_t));
+
+    mock->base.reset = mock_panel_nop;
+    mock->base.init = mock_panel_nop;
+    mock->base.del = mock_panel_del;
+    mock->base.draw_bitmap = mock_panel_draw_bitmap;
+    mock->base.mirror = mock_panel_mirror;
+    mock->base.swap_xy = mock_panel_swap_xy;
+    mock->base.set_gap = mock_panel_set_gap;
+    mock->base.invert_color = mock_panel_bool_nop;
+    mock->base.disp_on_off = mock_panel_bool_nop;
+    mock->base.disp_sleep = mock_panel_bool_nop;
+
+    mock->io.rx_param = mock_io_rx_param;
+    mock->io.tx_param = mock_io_tx_param;
+    mock->io.tx_color = mock_io_tx_color;
+    mock->io.del = mock_io_del;
+    mock->io.register_event_callbacks = mock_io_register_event_callbacks;
+
+    *ret_io = &mock->io;
+    *ret_panel = &mock->base;
+    return ESP_OK;
+
+err:
+    if (mock) {
+        free(mock->records);
+        free(mock);
+    }
+    return ret;
+}
+
+int64_t esp_lcd_mock_panel_get_time(esp_lcd_panel_handle_t panel)
+{
+    assert(panel);
+    mock_panel_t *mock = MOCK_CONTAINER_OF(panel, mock_panel_t, base);
+    return mock_panel_now(mock);
+}
+
+esp_err_t esp_lcd_mock_panel_get_stats(esp_lcd_panel_handle_t panel, esp_lcd_mock_panel_stats_t *stats)
+{
+    ESP_RETURN_ON_FALSE(panel && stats, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    mock_panel_t *mock = MOCK_CONTAINER_OF(panel, mock_panel_t, base);
+    memcpy(stats, &mock->stats, sizeof(esp_lcd_mock_panel_stats_t));
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_mock_panel_get_records(esp_lcd_panel_handle_t panel, const esp_lcd_mock_panel_record_t **records, size_t *count)
+{
+    ESP_RETURN_ON_FALSE(panel && records && count, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    mock_panel_t *mock = MOCK_CONTAINER_OF(panel, mock_panel_t, base);
+    *records = mock->records;
+    *count = mock->records_count;
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_mock_panel_reset_stats(esp_lcd_panel_handle_t panel)
+{
+    ESP_RETURN_ON_FALSE(panel, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    mock_panel_t *mock = MOCK_CONTAINER_OF(panel, mock_panel_t, base);
+    memset(&mock->stats, 0, sizeof(esp_lcd_mock_panel_stats_t));
+    mock->records_count = 0;
+    return ESP_OK;
+}
@@ -0,0 +1,127 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Recording mock LCD panel (host build)
+ *
+ * The mock panel does not draw anything. Every `esp_lcd_panel_draw_bitmap()` call is recorded (area, size and time)
+ * and the transfer is simulated on a virtual bus with configurable bandwidth, per-transaction overhead and completion
+ * latency. The `on_color_trans_done` callback registered on the panel IO is invoked before `draw_bitmap` returns.
+ *
+ * The mock keeps its own virtual clock: the wall clock (`esp_timer_get_time()`) plus all the time the caller would
+ * have been blocked by the bus. Use `esp_lcd_mock_panel_get_time()` to measure frame times.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "esp_lcd_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Mock panel configuration
+ */
+typedef struct {
+    unsigned int bits_per_pixel;    /*!< Color depth of the panel, used to compute transfer size */
+    uint32_t bus_bytes_per_sec;     /*!< Simulated bus bandwidth in bytes per second (0 = infinite) */
+    uint32_t trans_overhead_us;     /*!< Fixed cost of every draw_bitmap (commands, window setup, DMA setup) */
+    uint32_t trans_done_latency_us; /*!< Delay between end of the transfer and the done callback */
+    size_t max_records;             /*!< Number of draw_bitmap calls to record (0 = statistics only) */
+    struct {
+        unsigned int overlap_transfers: 1; /*!< Caller continues rendering while the transfer is in progress (double buffering) */
+    } flags;
+} esp_lcd_mock_panel_config_t;
+
+/**
+ * @brief One recorded draw_bitmap call
+ */
+typedef struct {
+    int x_start;            /*!< Start of the area on x-axis (included) */
+    int y_start;            /*!< Start of the area on y-axis (included) */
+    int x_end;              /*!< End of the area on x-axis (not included) */
+    int y_end;              /*!< End of the area on y-axis (not included) */
+    size_t bytes;           /*!< Transferred bytes */
+    int64_t timestamp_us;   /*!< Virtual time of the draw_bitmap call */
+    int64_t start_us;       /*!< Virtual time, when the transfer started on the bus */
+    int64_t done_us;        /*!< Virtual time, when the transfer was reported as done */
+} esp_lcd_mock_panel_record_t;
+
+/**
+ * @brief Accumulated mock panel statistics
+ */
+typedef struct {
+    uint32_t draw_count;    /*!< Number of draw_bitmap calls */
+    uint64_t bytes;         /*!< Transferred bytes */
+    uint64_t bus_busy_us;   /*!< Time the bus was busy */
+    uint64_t stall_us;      /*!< Time the caller was blocked waiting for the bus */
+    int64_t last_done_us;   /*!< Virtual time, when the last transfer was done */
+} esp_lcd_mock_panel_stats_t;
+
+/**
+ * @brief Create a new mock panel
+ *
+ * @note The panel IO handle is owned by the panel, it is released by `esp_lcd_panel_del()`.
+ *
+ * @param[in]  config     Mock panel configuration
+ * @param[out] ret_io     Returned panel IO handle
+ * @param[out] ret_panel  Returned panel handle
+ * @return
+ *      - ESP_OK                on success
+ *      - ESP_ERR_INVALID_ARG   if parameter is invalid
+ *      - ESP_ERR_NO_MEM        if out of memory
+ */
+esp_err_t esp_lcd_new_mock_panel(const esp_lcd_mock_panel_config_t *config, esp_lcd_panel_io_handle_t *ret_io, esp_lcd_panel_handle_t *ret_panel);
+
+/**
+ * @brief Get current virtual time of the mock panel
+ *
+ * @param panel  Mock panel handle
+ * @return Virtual time in microseconds
+ */
+int64_t esp_lcd_mock_panel_get_time(esp_lcd_panel_handle_t panel);
+
+/**
+ * @brief Get accumulated statistics
+ *
+ * @param[in]  panel  Mock panel handle
+ * @param[out] stats  Statistics
+ * @return
+ *      - ESP_OK                on success
+ *      - ESP_ERR_INVALID_ARG   if parameter is invalid
+ */
+esp_err_t esp_lcd_mock_panel_get_stats(esp_lcd_panel_handle_t panel, esp_lcd_mock_panel_stats_t *stats);
+
+/**
+ * @brief Get recorded draw_bitmap calls
+ *
+ * @param[in]  panel    Mock panel handle
+ * @param[out] records  Recorded calls (valid until next reset or panel deletion)
+ * @param[out] count    Number of recorded calls
+ * @return
+ *      - ESP_OK                on success
+ *      - ESP_ERR_INVALID_ARG   if parameter is invalid
+ */
+esp_err_t esp_lcd_mock_panel_get_records(esp_lcd_panel_handle_t panel, const esp_lcd_mock_panel_record_t **records, size_t *count);
+
+/**
+ * @brief Clear statistics and records
+ *
+ * @param panel  Mock panel handle
+ * @return
+ *      - ESP_OK                on success
+ *      - ESP_ERR_INVALID_ARG   if parameter is invalid
+ */
+esp_err_t esp_lcd_mock_panel_reset_stats(esp_lcd_panel_handle_t panel);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,109 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Mock of the ESP-IDF esp_lcd panel IO API (host build)
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include "esp_err.h"
+#include "esp_lcd_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Type of LCD panel IO event data
+ */
+typedef struct {
+} esp_lcd_panel_io_event_data_t;
+
+/**
+ * @brief Declare the prototype of the function that will be invoked when panel IO finishes transferring color data
+ *
+ * @param panel_io  LCD panel IO handle, which is created by factory API like `esp_lcd_new_mock_panel()`
+ * @param edata     Panel IO event data, fed by driver
+ * @param user_ctx  User data, passed from `esp_lcd_panel_io_register_event_callbacks()`
+ * @return Whether a high priority task has been waken up by this function
+ */
+typedef bool (*esp_lcd_panel_io_color_trans_done_cb_t)(esp_lcd_panel_io_handle_t panel_io, esp_lcd_panel_io_event_data_t *edata, void *user_ctx);
+
+/**
+ * @brief Type of LCD panel IO callbacks
+ */
+typedef struct {
+    esp_lcd_panel_io_color_trans_done_cb_t on_color_trans_done; /*!< Callback invoked when color data transfer has finished */
+} esp_lcd_panel_io_callbacks_t;
+
+/**
+ * @brief Transmit LCD command and corresponding parameters
+ *
+ * @param io            LCD panel IO handle
+ * @param lcd_cmd       The specific LCD command, set to -1 if no command needed
+ * @param param         Buffer that holds the command specific parameters, set to NULL if no parameter is needed
+ * @param param_size    Size of `param` in memory, in bytes, set to zero if no parameter is needed
+ * @return
+ *      - ESP_ERR_INVALID_ARG   if parameter is invalid
+ *      - ESP_OK                on success
+ */
+esp_err_t esp_lcd_panel_io_tx_param(esp_lcd_panel_io_handle_t io, int lcd_cmd, const void *param, size_t param_size);
+
+/**
+ * @brief Transmit LCD RGB data
+ *
+ * @param io            LCD panel IO handle
+ * @param lcd_cmd       The specific LCD command, set to -1 if no command needed
+ * @param color         Buffer that holds the RGB color data
+ * @param color_size    Size of `color` in memory, in bytes
+ * @return
+ *      - ESP_ERR_INVALID_ARG   if parameter is invalid
+ *      - ESP_OK                on success
+ */
+esp_err_t esp_lcd_panel_io_tx_color(esp_lcd_panel_io_handle_t io, int lcd_cmd, const void *color, size_t color_size);
+
+/**
+ * @brief Transmit LCD command and receive corresponding parameters
+ *
+ * @param io            LCD panel IO handle
+ * @param lcd_cmd       The specific LCD command, set to -1 if no command needed
+ * @param param         Buffer to hold the received parameters
+ * @param param_size    Size of `param` buffer
+ * @return
+ *      - ESP_ERR_INVALID_ARG   if parameter is invalid
+ *      - ESP_ERR_NOT_SUPPORTED if read is not supported by transport
+ *      - ESP_OK                on success
+ */
+esp_err_t esp_lcd_panel_io_rx_param(esp_lcd_panel_io_handle_t io, int lcd_cmd, void *param, size_t param_size);
+
+/**
+ * @brief Destroy LCD panel IO handle (deinitialize panel and free all corresponding resource)
+ *
+ * @param io    LCD panel IO handle
+ * @return
+ *      - ESP_ERR_INVALID_ARG   if parameter is invalid
+ *      - ESP_OK                on success
+ */
+esp_err_t esp_lcd_panel_io_del(esp_lcd_panel_io_handle_t io);
+
+/**
+ * @brief Register LCD panel IO callbacks
+ *
+ * @param io        LCD panel IO handle
+ * @param cbs       structure with all LCD panel IO callbacks
+ * @param user_ctx  User private data, passed directly to callback's user_ctx
+ * @return
+ *      - ESP_ERR_INVALID_ARG   if parameter is invalid
+ *      - ESP_OK                on success
+ */
+esp_err_t esp_lcd_panel_io_register_event_callbacks(esp_lcd_panel_io_handle_t io, const esp_lcd_panel_io_callbacks_t *cbs, void *user_ctx);
+
+#ifdef __cplusplus
+}
+#endif
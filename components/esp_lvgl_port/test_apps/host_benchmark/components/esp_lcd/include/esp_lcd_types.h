@@ -0,0 +1,42 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Mock of the ESP-IDF esp_lcd types (host build)
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct esp_lcd_panel_io_t *esp_lcd_panel_io_handle_t; /*!< Type of LCD panel IO handle */
+typedef struct esp_lcd_panel_t *esp_lcd_panel_handle_t;       /*!< Type of LCD panel handle */
+
+/**
+ * @brief RGB element order
+ */
+typedef enum {
+    LCD_RGB_ELEMENT_ORDER_RGB = 0, /*!< RGB element order: RGB */
+    LCD_RGB_ELEMENT_ORDER_BGR = 1, /*!< RGB element order: BGR */
+} lcd_rgb_element_order_t;
+
+/**
+ * @brief RGB data endian
+ */
+typedef enum {
+    LCD_RGB_DATA_ENDIAN_BIG = 0, /*!< RGB data endian: MSB first */
+    LCD_RGB_DATA_ENDIAN_LITTLE,  /*!< RGB data endian: LSB first */
+} lcd_rgb_data_endian_t;
+
+#ifdef __cplusplus
+}
+#endif
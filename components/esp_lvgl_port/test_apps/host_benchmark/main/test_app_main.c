@@ -0,0 +1,28 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "unity.h"
+
+void app_main(void)
+{
+    printf("TEST ESP LVGL port (host benchmark)\n\r");
+
+    UNITY_BEGIN();
+    unity_run_all_tests();
+    exit(UNITY_END());
+}
+
+/* setUp runs before every test */
+void setUp(void)
+{
+}
+
+/* tearDown runs after every test */
+void tearDown(void)
+{
+}
@@ -0,0 +1,478 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdio.h>
+#include <inttypes.h>
+#include "esp_err.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_lcd_panel_io.h"
+#include "esp_lcd_panel_ops.h"
+#include "esp_lcd_mock_panel.h"
+#include "esp_lvgl_port.h"
+
+#include "unity.h"
+
+/* LCD size */
+#define BENCH_LCD_H_RES             (320)
+#define BENCH_LCD_V_RES             (240)
+#define BENCH_LCD_BITS_PER_PIXEL    (16)
+#define BENCH_LCD_DRAW_BUFF_HEIGHT  (24)    /* 1/10 of the screen */
+
+/* Simulated bus: SPI 40 MHz */
+#define BENCH_BUS_BYTES_PER_SEC     (40 * 1000 * 1000 / 8)
+#define BENCH_BUS_TRANS_OVERHEAD_US (20)    /* CASET + RASET + RAMWR and DMA setup */
+#define BENCH_BUS_DONE_LATENCY_US   (5)
+
+/* Benchmark settings */
+#define BENCH_FRAMES                (100)
+#define BENCH_LABELS_COLS           (4)
+#define BENCH_LABELS_ROWS           (6)
+
+static const char *TAG = "bench";
+
+/**
+ * @brief Display configuration of one benchmark run
+ */
+typedef struct {
+    const char *name;
+    uint32_t buff_height;       /* Height of the draw buffer, 0 = full screen */
+    bool double_buffer;
+    bool full_refresh;
+    bool direct_mode;
+    bool sw_rotate;
+    bool swap_bytes;
+    bool merge_areas;
+    bool monochrome;
+    bool buff_pool;             /* Buffers from the shared buffer pool */
+    bool flush_task;            /* Display flushed by own flush task */
+    lv_display_rotation_t rotation;
+} bench_disp_params_t;
+
+/**
+ * @brief Scene drawn in every frame
+ */
+typedef enum {
+    BENCH_SCENE_WIDGETS,        /* Many small labels updated every frame */
+    BENCH_SCENE_FULLSCREEN,     /* Background of the whole screen changed every frame */
+} bench_scene_t;
+
+static const char *bench_scene_name[] = {"widgets", "fullscreen"};
+
+static lv_obj_t *bench_labels[BENCH_LABELS_COLS * BENCH_LABELS_ROWS];
+
+static void bench_scene_create(lv_display_t *disp, bench_scene_t scene)
+{
+    lv_obj_t *scr = lv_display_get_screen_active(disp);
+    lv_obj_clean(scr);
+    lv_obj_set_style_bg_color(scr, lv_color_black(), 0);
+
+    if (scene == BENCH_SCENE_WIDGETS) {
+        const int32_t cell_w = lv_display_get_horizontal_resolution(disp) / BENCH_LABELS_COLS;
+        const int32_t cell_h = lv_display_get_vertical_resolution(disp) / BENCH_LABELS_ROWS;
+        for (int i = 0; i < BENCH_LABELS_COLS * BENCH_LABELS_ROWS; i++) {
+            bench_labels[i] = lv_label_create(scr);
+            lv_obj_set_style_text_color(bench_labels[i], lv_color_white(), 0);
+            lv_obj_set_pos(bench_labels[i], (i % BENCH_LABELS_COLS) * cell_w + 4, (i / BENCH_LABELS_COLS) * cell_h + 4);
+            lv_label_set_text(bench_labels[i], "0");
+        }
+    }
+}
+
+static void bench_scene_update(lv_display_t *disp, bench_scene_t scene, uint32_t frame)
+{
+    if (scene == BENCH_SCENE_WIDGETS) {
+        for (int i = 0; i < BENCH_LABELS_COLS * BENCH_LABELS_ROWS; i++) {
+            lv_label_set_text_fmt(bench_labels[i], "%" PRIu32, frame * 7 + i);
+        }
+    } else {
+        lv_obj_t *scr = lv_display_get_screen_active(disp);
+        lv_obj_set_style_bg_color(scr, (frame & 1) ? lv_color_white() : lv_color_black(), 0);
+    }
+}
+
+static void bench_run(const bench_disp_params_t *params, bench_scene_t scene)
+{
+    esp_lcd_panel_io_handle_t io = NULL;
+    esp_lcd_panel_handle_t panel = NULL;
+
+    /* Mock LCD */
+    const esp_lcd_mock_panel_config_t mock_cfg = {
+        .bits_per_pixel = (params->monochrome ? 1 : BENCH_LCD_BITS_PER_PIXEL),
+        .bus_bytes_per_sec = BENCH_BUS_BYTES_PER_SEC,
+        .trans_overhead_us = BENCH_BUS_TRANS_OVERHEAD_US,
+        .trans_done_latency_us = BENCH_BUS_DONE_LATENCY_US,
+        .flags = {
+            .overlap_transfers = params->double_buffer,
+        }
+    };
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_new_mock_panel(&mock_cfg, &io, &panel));
+
+    /* LVGL port */
+    const lvgl_port_cfg_t lvgl_cfg = ESP_LVGL_PORT_INIT_CONFIG();
+    TEST_ASSERT_EQUAL(ESP_OK, lvgl_port_init(&lvgl_cfg));
+
+    const uint32_t buff_height = (params->buff_height ? params->buff_height : BENCH_LCD_V_RES);
+    if (params->buff_pool) {
+        const lvgl_port_buff_pool_cfg_t pool_cfg = {
+            .buff_size = BENCH_LCD_H_RES * buff_height * sizeof(lv_color_t),
+            .buff_count = (params->double_buffer ? 2 : 1) + (params->sw_rotate ? 2 : 0),
+        };
+        TEST_ASSERT_EQUAL(ESP_OK, lvgl_port_buff_pool_init(&pool_cfg));
+    }
+    const lvgl_port_display_cfg_t disp_cfg = {
+        .io_handle = io,
+        .panel_handle = panel,
+        .buffer_size = BENCH_LCD_H_RES * buff_height,
+        .double_buffer = params->double_buffer,
+        .hres = BENCH_LCD_H_RES,
+        .vres = BENCH_LCD_V_RES,
+        .monochrome = params->monochrome,
+        .flush_task_priority = (params->flush_task ? 5 : 0),
+        .flush_task_affinity = -1,
+        .flags = {
+            .sw_rotate = params->sw_rotate,
+            .pipelined_rotation = params->sw_rotate,
+            .swap_bytes = params->swap_bytes,
+            .full_refresh = params->full_refresh,
+            .direct_mode = params->direct_mode,
+            .merge_areas = params->merge_areas,
+            .buff_pool = params->buff_pool,
+        }
+    };
+    lv_display_t *disp = lvgl_port_add_disp(&disp_cfg);
+    TEST_ASSERT_NOT_NULL(disp);
+
+    /* Prepare scene and draw the first frame (not measured) */
+    lvgl_port_lock(0);
+    lv_display_set_rotation(disp, params->rotation);
+    bench_scene_create(disp, scene);
+    lv_refr_now(disp);
+    lvgl_port_unlock();
+
+    esp_lcd_mock_panel_reset_stats(panel);
+    lvgl_port_reset_disp_stats(disp);
+
+    /* Measured frames */
+    int64_t frames_time_us = 0;
+    int64_t end_time_us = 0;
+    for (uint32_t frame = 1; frame <= BENCH_FRAMES; frame++) {
+        lvgl_port_lock(0);
+        bench_scene_update(disp, scene, frame);
+        const int64_t start_time_us = esp_lcd_mock_panel_get_time(panel);
+        lv_refr_now(disp);
+        end_time_us = esp_lcd_mock_panel_get_time(panel);
+        frames_time_us += end_time_us - start_time_us;
+        lvgl_port_unlock();
+    }
+
+    if (params->flush_task) {
+        /* Let the flush task finish the last frame */
+        vTaskDelay(pdMS_TO_TICKS(100));
+    }
+
+    esp_lcd_mock_panel_stats_t stats;
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_mock_panel_get_stats(panel, &stats));
+    /* The last transfer may be still in progress */
+    if (stats.last_done_us > end_time_us) {
+        frames_time_us += stats.last_done_us - end_time_us;
+    }
+
+    printf("%-28s %-10s | %7.1f fps | %7" PRIu64 " B/frame | %5.1f draws/frame | %7.1f us stall/frame | %7.1f us bus/frame\n",
+           params->name, bench_scene_name[scene],
+           (frames_time_us > 0 ? BENCH_FRAMES * 1000000.0 / frames_time_us : 0.0),
+           stats.bytes / BENCH_FRAMES,
+           (float)stats.draw_count / BENCH_FRAMES,
+           (float)stats.stall_us / BENCH_FRAMES,
+           (float)stats.bus_busy_us / BENCH_FRAMES);
+
+    TEST_ASSERT_GREATER_OR_EQUAL(BENCH_FRAMES, stats.draw_count);
+    TEST_ASSERT_GREATER_THAN(0, stats.bytes);
+
+    /* Counters of the LVGL port must match the panel */
+    lvgl_port_disp_stats_t port_stats;
+    TEST_ASSERT_EQUAL(ESP_OK, lvgl_port_get_disp_stats(disp, &port_stats));
+    TEST_ASSERT_EQUAL_UINT32(BENCH_FRAMES, port_stats.frames);
+    TEST_ASSERT_EQUAL_UINT32(stats.draw_count, port_stats.flushes);
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)stats.bytes, (uint32_t)port_stats.bytes_sent);
+
+    /* Cleanup */
+    TEST_ASSERT_EQUAL(ESP_OK, lvgl_port_remove_disp(disp));
+    if (params->buff_pool) {
+        TEST_ASSERT_EQUAL(ESP_OK, lvgl_port_buff_pool_deinit());
+    }
+    TEST_ASSERT_EQUAL(ESP_OK, lvgl_port_deinit());
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_panel_del(panel));
+}
+
+static void bench_run_all_scenes(const bench_disp_params_t *params)
+{
+    ESP_LOGI(TAG, "Benchmark: %s", params->name);
+    bench_run(params, BENCH_SCENE_WIDGETS);
+    bench_run(params, BENCH_SCENE_FULLSCREEN);
+}
+
+TEST_CASE("Benchmark partial, single buffer", "[benchmark][partial]")
+{
+    const bench_disp_params_t params = {
+        .name = "partial 1/10",
+        .buff_height = BENCH_LCD_DRAW_BUFF_HEIGHT,
+    };
+    bench_run_all_scenes(&params);
+}
+
+TEST_CASE("Benchmark partial, double buffer", "[benchmark][partial]")
+{
+    const bench_disp_params_t params = {
+        .name = "partial 1/10 double",
+        .buff_height = BENCH_LCD_DRAW_BUFF_HEIGHT,
+        .double_buffer = true,
+    };
+    bench_run_all_scenes(&params);
+}
+
+TEST_CASE("Benchmark partial, double buffer, merged areas", "[benchmark][partial]")
+{
+    const bench_disp_params_t params = {
+        .name = "partial 1/10 double merge",
+        .buff_height = BENCH_LCD_DRAW_BUFF_HEIGHT,
+        .double_buffer = true,
+        .merge_areas = true,
+    };
+    bench_run_all_scenes(&params);
+}
+
+TEST_CASE("Benchmark full refresh", "[benchmark][full_refresh]")
+{
+    const bench_disp_params_t params = {
+        .name = "full_refresh double",
+        .double_buffer = true,
+        .full_refresh = true,
+    };
+    bench_run_all_scenes(&params);
+}
+
+TEST_CASE("Benchmark direct mode", "[benchmark][direct_mode]")
+{
+    const bench_disp_params_t params = {
+        .name = "direct_mode double",
+        .double_buffer = true,
+        .direct_mode = true,
+    };
+    bench_run_all_scenes(&params);
+}
+
+TEST_CASE("Benchmark direct mode, merged areas", "[benchmark][direct_mode]")
+{
+    const bench_disp_params_t params = {
+        .name = "direct_mode double merge",
+        .double_buffer = true,
+        .direct_mode = true,
+        .merge_areas = true,
+    };
+    bench_run_all_scenes(&params);
+}
+
+TEST_CASE("Benchmark SW rotation", "[benchmark][sw_rotate]")
+{
+    const bench_disp_params_t params = {
+        .name = "sw_rotate 90 1/10 double",
+        .buff_height = BENCH_LCD_DRAW_BUFF_HEIGHT,
+        .double_buffer = true,
+        .sw_rotate = true,
+        .rotation = LV_DISPLAY_ROTATION_90,
+    };
+    bench_run_all_scenes(&params);
+}
+
+TEST_CASE("Benchmark SW rotation with swap bytes", "[benchmark][sw_rotate]")
+{
+    const bench_disp_params_t params = {
+        .name = "sw_rotate 90 swap 1/10 double",
+        .buff_height = BENCH_LCD_DRAW_BUFF_HEIGHT,
+        .double_buffer = true,
+        .sw_rotate = true,
+        .swap_bytes = true,
+        .rotation = LV_DISPLAY_ROTATION_90,
+    };
+    bench_run_all_scenes(&params);
+}
+
+TEST_CASE("Benchmark SW rotation 0 with swap bytes", "[benchmark][sw_rotate]")
+{
+    const bench_disp_params_t params = {
+        .name = "sw_rotate 0 swap 1/10 double",
+        .buff_height = BENCH_LCD_DRAW_BUFF_HEIGHT,
+        .double_buffer = true,
+        .sw_rotate = true,
+        .swap_bytes = true,
+        .rotation = LV_DISPLAY_ROTATION_0,
+    };
+    bench_run_all_scenes(&params);
+}
+
+TEST_CASE("Benchmark monochrome", "[benchmark][monochrome]")
+{
+    const bench_disp_params_t params = {
+        .name = "monochrome 1/10",
+        .buff_height = BENCH_LCD_DRAW_BUFF_HEIGHT,
+        .monochrome = true,
+    };
+    bench_run_all_scenes(&params);
+}
+
+TEST_CASE("Benchmark monochrome rotated", "[benchmark][monochrome]")
+{
+    const bench_disp_params_t params = {
+        .name = "monochrome 90 1/10",
+        .buff_height = BENCH_LCD_DRAW_BUFF_HEIGHT,
+        .monochrome = true,
+        .rotation = LV_DISPLAY_ROTATION_90,
+    };
+    bench_run_all_scenes(&params);
+}
+
+TEST_CASE("Benchmark partial, double buffer, flush task", "[benchmark][flush_task]")
+{
+    const bench_disp_params_t params = {
+        .name = "partial 1/10 double task",
+        .buff_height = BENCH_LCD_DRAW_BUFF_HEIGHT,
+        .double_buffer = true,
+        .flush_task = true,
+    };
+    bench_run_all_scenes(&params);
+}
+
+TEST_CASE("Benchmark SW rotation, flush task", "[benchmark][flush_task]")
+{
+    const bench_disp_params_t params = {
+        .name = "sw_rotate 90 1/10 double task",
+        .buff_height = BENCH_LCD_DRAW_BUFF_HEIGHT,
+        .double_buffer = true,
+        .sw_rotate = true,
+        .flush_task = true,
+        .rotation = LV_DISPLAY_ROTATION_90,
+    };
+    bench_run_all_scenes(&params);
+}
+
+TEST_CASE("Benchmark SW rotation, buffer pool", "[benchmark][buff_pool]")
+{
+    const bench_disp_params_t params = {
+        .name = "sw_rotate 90 1/10 double pool",
+        .buff_height = BENCH_LCD_DRAW_BUFF_HEIGHT,
+        .double_buffer = true,
+        .sw_rotate = true,
+        .buff_pool = true,
+        .rotation = LV_DISPLAY_ROTATION_90,
+    };
+    bench_run_all_scenes(&params);
+}
+
+TEST_CASE("Buffer pool shared by two displays", "[buff_pool]")
+{
+    esp_lcd_panel_io_handle_t io[2] = {NULL};
+    esp_lcd_panel_handle_t panel[2] = {NULL};
+    lv_display_t *disp[2] = {NULL};
+    const uint32_t vres[2] = {BENCH_LCD_V_RES, BENCH_LCD_V_RES / 2};
+
+    const lvgl_port_cfg_t lvgl_cfg = ESP_LVGL_PORT_INIT_CONFIG();
+    TEST_ASSERT_EQUAL(ESP_OK, lvgl_port_init(&lvgl_cfg));
+
+    /* Buffers for the larger display */
+    const lvgl_port_buff_pool_cfg_t pool_cfg = {
+        .buff_size = BENCH_LCD_H_RES * BENCH_LCD_DRAW_BUFF_HEIGHT * sizeof(lv_color_t),
+        .buff_count = 2,
+    };
+    TEST_ASSERT_EQUAL(ESP_OK, lvgl_port_buff_pool_init(&pool_cfg));
+
+    for (int i = 0; i < 2; i++) {
+        const esp_lcd_mock_panel_config_t mock_cfg = {
+            .bits_per_pixel = BENCH_LCD_BITS_PER_PIXEL,
+            .bus_bytes_per_sec = BENCH_BUS_BYTES_PER_SEC,
+            .flags.overlap_transfers = true,
+        };
+        TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_new_mock_panel(&mock_cfg, &io[i], &panel[i]));
+    }
+
+    /* Displays are removed and added again, buffers stay in the pool */
+    for (int round = 0; round < 2; round++) {
+        for (int i = 0; i < 2; i++) {
+            const lvgl_port_display_cfg_t disp_cfg = {
+                .io_handle = io[i],
+                .panel_handle = panel[i],
+                .buffer_size = BENCH_LCD_H_RES * BENCH_LCD_DRAW_BUFF_HEIGHT / (i + 1),
+                .double_buffer = true,
+                .hres = BENCH_LCD_H_RES,
+                .vres = vres[i],
+                .flags.buff_pool = true,
+            };
+            disp[i] = lvgl_port_add_disp(&disp_cfg);
+            TEST_ASSERT_NOT_NULL(disp[i]);
+        }
+
+        for (int i = 0; i < 2; i++) {
+            lvgl_port_lock(0);
+            esp_lcd_mock_panel_reset_stats(panel[i]);
+            bench_scene_create(disp[i], BENCH_SCENE_FULLSCREEN);
+            lv_refr_now(disp[i]);
+            lvgl_port_unlock();
+
+            esp_lcd_mock_panel_stats_t stats;
+            TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_mock_panel_get_stats(panel[i], &stats));
+            TEST_ASSERT_EQUAL_UINT32(BENCH_LCD_H_RES * vres[i] * BENCH_LCD_BITS_PER_PIXEL / 8, (uint32_t)stats.bytes);
+        }
+
+        /* Pool cannot be freed, while it is used */
+        TEST_ASSERT_EQUAL(ESP_ERR_INVALID_STATE, lvgl_port_buff_pool_deinit());
+        for (int i = 0; i < 2; i++) {
+            TEST_ASSERT_EQUAL(ESP_OK, lvgl_port_remove_disp(disp[i]));
+        }
+    }
+
+    /* Display with larger draw buffer than the pool buffers */
+    const lvgl_port_display_cfg_t big_cfg = {
+        .io_handle = io[0],
+        .panel_handle = panel[0],
+        .buffer_size = BENCH_LCD_H_RES * BENCH_LCD_DRAW_BUFF_HEIGHT * 2,
+        .hres = BENCH_LCD_H_RES,
+        .vres = BENCH_LCD_V_RES,
+        .flags.buff_pool = true,
+    };
+    TEST_ASSERT_NULL(lvgl_port_add_disp(&big_cfg));
+
+    TEST_ASSERT_EQUAL(ESP_OK, lvgl_port_buff_pool_deinit());
+    TEST_ASSERT_EQUAL(ESP_OK, lvgl_port_deinit());
+    for (int i = 0; i < 2; i++) {
+        TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_panel_del(panel[i]));
+    }
+}
+
+TEST_CASE("Tickless LVGL time", "[tickless]")
+{
+    lvgl_port_cfg_t lvgl_cfg = ESP_LVGL_PORT_INIT_CONFIG();
+    lvgl_cfg.tickless = true;
+    TEST_ASSERT_EQUAL(ESP_OK, lvgl_port_init(&lvgl_cfg));
+
+    lvgl_port_lock(0);
+    const uint32_t start = lv_tick_get();
+    lvgl_port_unlock();
+
+    vTaskDelay(pdMS_TO_TICKS(100));
+
+    lvgl_port_lock(0);
+    const uint32_t elapsed = lv_tick_elaps(start);
+    lvgl_port_unlock();
+    ESP_LOGI(TAG, "Tickless: %"PRIu32" ms elapsed", elapsed);
+    TEST_ASSERT_UINT32_WITHIN(50, 100, elapsed);
+
+    /* Without tick timer, stop and resume only pause LVGL timers */
+    TEST_ASSERT_EQUAL(ESP_OK, lvgl_port_stop());
+    TEST_ASSERT_EQUAL(ESP_OK, lvgl_port_resume());
+
+    TEST_ASSERT_EQUAL(ESP_OK, lvgl_port_deinit());
+}
@@ -0,0 +1,222 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdio.h>
+#include <inttypes.h>
+#include <sys/param.h>
+#include "esp_err.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_lcd_panel_io.h"
+#include "esp_lcd_panel_ops.h"
+#include "esp_lcd_mock_panel.h"
+#include "esp_lcd_touch.h"
+#include "esp_lcd_touch_virtual.h"
+#include "esp_lvgl_port.h"
+
+#include "unity.h"
+
+/* LCD size */
+#define LATENCY_LCD_H_RES           (320)
+#define LATENCY_LCD_V_RES           (240)
+#define LATENCY_LCD_DRAW_BUFF_HEIGHT (24)   /* 1/10 of the screen */
+
+/* Simulated bus: SPI 40 MHz */
+#define LATENCY_BUS_BYTES_PER_SEC   (40 * 1000 * 1000 / 8)
+#define LATENCY_BUS_TRANS_OVERHEAD_US (20)
+#define LATENCY_BUS_DONE_LATENCY_US (5)
+#define LATENCY_MAX_RECORDS         (4096)
+
+/* Drag gesture: 100 Hz touch controller, 400 px/s */
+#define LATENCY_TRACE_SAMPLES       (50)
+#define LATENCY_TRACE_PERIOD_US     (10000)
+#define LATENCY_TRACE_X0            (40)
+#define LATENCY_TRACE_STEP          (4)
+#define LATENCY_TRACE_Y             (120)
+#define LATENCY_BOX_SIZE            (40)
+
+/* Virtual touch interrupt pin (emulated on the host) */
+#define LATENCY_TOUCH_INT_GPIO      (GPIO_NUM_0)
+
+/**
+ * @brief Touch sample handled by LVGL
+ */
+typedef struct {
+    int index;              /* Index of the sample in the trace */
+    int64_t handled_us;     /* Time, when LVGL handled the sample */
+    int64_t handled_virt_us;/* Virtual time of the mock panel, when LVGL handled the sample */
+} latency_event_t;
+
+static struct {
+    esp_lcd_panel_handle_t panel;
+    lv_obj_t *box;
+    latency_event_t events[LATENCY_TRACE_SAMPLES];
+    int events_count;
+} latency_ctx;
+
+/* Box follows the touch, each touch sample produces one redraw */
+static void latency_touch_event_cb(lv_event_t *e)
+{
+    const lv_event_code_t code = lv_event_get_code(e);
+    if (code != LV_EVENT_PRESSED && code != LV_EVENT_PRESSING) {
+        return;
+    }
+
+    lv_point_t point;
+    lv_indev_get_point(lv_indev_active(), &point);
+    lv_obj_set_pos(latency_ctx.box, point.x - LATENCY_BOX_SIZE / 2, point.y - LATENCY_BOX_SIZE / 2);
+
+    /* Sample is identified by its position, LVGL reads the touch again for the held touch */
+    const int index = (point.x - LATENCY_TRACE_X0) / LATENCY_TRACE_STEP;
+    const int count = latency_ctx.events_count;
+    if (index < 0 || index >= LATENCY_TRACE_SAMPLES || count >= LATENCY_TRACE_SAMPLES ||
+            (count > 0 && latency_ctx.events[count - 1].index == index)) {
+        return;
+    }
+    latency_ctx.events[count] = (latency_event_t) {
+        .index = index,
+        .handled_us = esp_timer_get_time(),
+        .handled_virt_us = esp_lcd_mock_panel_get_time(latency_ctx.panel),
+    };
+    latency_ctx.events_count++;
+}
+
+TEST_CASE("Benchmark touch to flush latency", "[benchmark][touch]")
+{
+    esp_lcd_panel_io_handle_t io = NULL;
+    esp_lcd_touch_handle_t tp = NULL;
+    esp_lcd_touch_virtual_sample_t trace[LATENCY_TRACE_SAMPLES + 1];
+
+    latency_ctx.events_count = 0;
+
+    /* Mock LCD */
+    const esp_lcd_mock_panel_config_t mock_cfg = {
+        .bits_per_pixel = 16,
+        .bus_bytes_per_sec = LATENCY_BUS_BYTES_PER_SEC,
+        .trans_overhead_us = LATENCY_BUS_TRANS_OVERHEAD_US,
+        .trans_done_latency_us = LATENCY_BUS_DONE_LATENCY_US,
+        .max_records = LATENCY_MAX_RECORDS,
+        .flags.overlap_transfers = true,
+    };
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_new_mock_panel(&mock_cfg, &io, &latency_ctx.panel));
+
+    /* Drag and release */
+    for (int i = 0; i <= LATENCY_TRACE_SAMPLES; i++) {
+        trace[i] = (esp_lcd_touch_virtual_sample_t) {
+            .time_us = (i + 1) * LATENCY_TRACE_PERIOD_US,
+            .points = (i < LATENCY_TRACE_SAMPLES ? 1 : 0),
+            .coords = {{.x = LATENCY_TRACE_X0 + (i * LATENCY_TRACE_STEP), .y = LATENCY_TRACE_Y}},
+        };
+    }
+    const esp_lcd_touch_virtual_config_t virtual_cfg = {
+        .samples = trace,
+        .samples_count = LATENCY_TRACE_SAMPLES + 1,
+    };
+    const esp_lcd_touch_config_t tp_cfg = {
+        .x_max = LATENCY_LCD_H_RES,
+        .y_max = LATENCY_LCD_V_RES,
+        .rst_gpio_num = GPIO_NUM_NC,
+        .int_gpio_num = LATENCY_TOUCH_INT_GPIO,
+        .driver_data = (void *) &virtual_cfg,
+    };
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_touch_new_virtual(&tp_cfg, &tp));
+
+    /* LVGL port, the touch is used in event mode (interrupt pin is set) */
+    const lvgl_port_cfg_t lvgl_cfg = ESP_LVGL_PORT_INIT_CONFIG();
+    TEST_ASSERT_EQUAL(ESP_OK, lvgl_port_init(&lvgl_cfg));
+    const lvgl_port_display_cfg_t disp_cfg = {
+        .io_handle = io,
+        .panel_handle = latency_ctx.panel,
+        .buffer_size = LATENCY_LCD_H_RES * LATENCY_LCD_DRAW_BUFF_HEIGHT,
+        .double_buffer = true,
+        .hres = LATENCY_LCD_H_RES,
+        .vres = LATENCY_LCD_V_RES,
+    };
+    lv_display_t *disp = lvgl_port_add_disp(&disp_cfg);
+    TEST_ASSERT_NOT_NULL(disp);
+    const lvgl_port_touch_cfg_t touch_cfg = {
+        .disp = disp,
+        .handle = tp,
+    };
+    lv_indev_t *indev = lvgl_port_add_touch(&touch_cfg);
+    TEST_ASSERT_NOT_NULL(indev);
+
+    /* Scene: box following the touch, the screen gets the touch events */
+    lvgl_port_lock(0);
+    lv_obj_t *scr = lv_display_get_screen_active(disp);
+    lv_obj_clean(scr);
+    lv_obj_set_style_bg_color(scr, lv_color_black(), 0);
+    lv_obj_remove_flag(scr, LV_OBJ_FLAG_SCROLLABLE);
+    latency_ctx.box = lv_obj_create(scr);
+    lv_obj_set_size(latency_ctx.box, LATENCY_BOX_SIZE, LATENCY_BOX_SIZE);
+    lv_obj_remove_flag(latency_ctx.box, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_add_event_cb(scr, latency_touch_event_cb, LV_EVENT_ALL, NULL);
+    lv_refr_now(disp);
+    esp_lcd_mock_panel_reset_stats(latency_ctx.panel);
+    lvgl_port_unlock();
+
+    /* Play the gesture and let LVGL draw the last frame, LVGL is idle after it */
+    esp_lcd_touch_virtual_status_t status;
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_touch_virtual_start(tp));
+    do {
+        vTaskDelay(pdMS_TO_TICKS(10));
+        TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_touch_virtual_get_status(tp, &status));
+    } while (status.running);
+    vTaskDelay(pdMS_TO_TICKS(200));
+
+    /* Latency of each handled sample: touch -> LVGL (wall time) + LVGL -> last flush of the next frame done (virtual time) */
+    const esp_lcd_mock_panel_record_t *records = NULL;
+    size_t records_count = 0;
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_mock_panel_get_records(latency_ctx.panel, &records, &records_count));
+    TEST_ASSERT_LESS_THAN(LATENCY_MAX_RECORDS, records_count);
+
+    int64_t input_sum = 0;
+    int64_t total_sum = 0;
+    int64_t total_max = 0;
+    int measured = 0;
+    size_t r = 0;
+    for (int e = 0; e < latency_ctx.events_count; e++) {
+        const latency_event_t *event = &latency_ctx.events[e];
+        const int64_t next_virt_us = (e + 1 < latency_ctx.events_count ? latency_ctx.events[e + 1].handled_virt_us : INT64_MAX);
+        int64_t done_us = 0;
+
+        /* Flushes between this and the next handled sample show this sample */
+        while (r < records_count && records[r].timestamp_us < event->handled_virt_us) {
+            r++;
+        }
+        for (; r < records_count && records[r].timestamp_us < next_virt_us; r++) {
+            done_us = MAX(done_us, records[r].done_us);
+        }
+        if (done_us == 0) {
+            continue;
+        }
+
+        const int64_t input_us = event->handled_us - (status.start_us + trace[event->index].time_us);
+        const int64_t total_us = input_us + (done_us - event->handled_virt_us);
+        TEST_ASSERT_GREATER_OR_EQUAL(0, input_us);
+        input_sum += input_us;
+        total_sum += total_us;
+        total_max = MAX(total_max, total_us);
+        measured++;
+    }
+
+    printf("touch latency | %d/%d samples handled, %d drawn | %7.1f us touch to LVGL | %7.1f us avg, %7" PRId64 " us max touch to flush done\n",
+           latency_ctx.events_count, LATENCY_TRACE_SAMPLES, measured,
+           (measured > 0 ? (float)input_sum / measured : 0.0f),
+           (measured > 0 ? (float)total_sum / measured : 0.0f), total_max);
+
+    /* Most samples of the drag are handled and drawn, the touch is not delayed by more than a few frames */
+    TEST_ASSERT_GREATER_OR_EQUAL(LATENCY_TRACE_SAMPLES / 2, measured);
+    TEST_ASSERT_LESS_THAN(100000, total_max);
+
+    /* Cleanup */
+    TEST_ASSERT_EQUAL(ESP_OK, lvgl_port_remove_touch(indev));
+    TEST_ASSERT_EQUAL(ESP_OK, lvgl_port_remove_disp(disp));
+    TEST_ASSERT_EQUAL(ESP_OK, lvgl_port_deinit());
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_touch_del(tp));
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_panel_del(latency_ctx.panel));
+}
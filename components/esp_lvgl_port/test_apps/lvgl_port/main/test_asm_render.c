@@ -0,0 +1,214 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include "esp_log.h"
+#include "esp_lvgl_port.h"
+
+#include "unity.h"
+
+/*
+ * Check, that the assembly render of esp_lvgl_port is linked and used by LVGL.
+ *
+ * The assembly functions are wrapped by the linker (-Wl,--wrap in CMakeLists.txt), the wrappers count the calls.
+ * LVGL renders screens with a filled background, plain, semi-transparent and rounded rectangles, a text and images
+ * of all the supported color formats (plain, with opacity, with rounded corners and with both) into an RGB565 and
+ * an ARGB8888 display without hardware. All the wrapped functions must be called.
+ */
+#if CONFIG_LV_DRAW_SW_ASM_CUSTOM && CONFIG_LVGL_PORT_ASM_BLEND_EXPERIMENTAL && (CONFIG_IDF_TARGET_ESP32 || CONFIG_IDF_TARGET_ESP32S3)
+
+#define TEST_DISP_H_RES     (160)
+#define TEST_DISP_V_RES     (120)
+#define TEST_IMG_SIZE       (16)
+#define TEST_IMG_RADIUS     (6)
+
+/* L8 and AL88 images are blended by the hooks since LVGL 9.2, the functions are wrapped (linked) anyway */
+#define TEST_ASM_L8_AL88    ((LVGL_VERSION_MAJOR > 9) || ((LVGL_VERSION_MAJOR == 9) && (LVGL_VERSION_MINOR >= 2)))
+
+/* Wrapped assembly functions (the list must match WRAPPED_ASM_SYMBOLS in CMakeLists.txt), L8 and AL88 are the last */
+#define TEST_ASM_FUNCS_L8_AL88(X) \
+    X(lv_l8_blend_normal_to_rgb565_esp) \
+    X(lv_l8_blend_normal_to_rgb565_with_opa_esp) \
+    X(lv_l8_blend_normal_to_rgb565_with_mask_esp) \
+    X(lv_l8_blend_normal_to_rgb565_mix_mask_opa_esp) \
+    X(lv_al88_blend_normal_to_rgb565_esp) \
+    X(lv_al88_blend_normal_to_rgb565_with_opa_esp) \
+    X(lv_al88_blend_normal_to_rgb565_with_mask_esp) \
+    X(lv_al88_blend_normal_to_rgb565_mix_mask_opa_esp)
+
+#define TEST_ASM_FUNCS(X) \
+    X(lv_color_blend_to_rgb565_esp) \
+    X(lv_color_blend_to_rgb565_with_opa_esp) \
+    X(lv_color_blend_to_rgb565_with_mask_esp) \
+    X(lv_color_blend_to_rgb565_mix_mask_opa_esp) \
+    X(lv_color_blend_to_argb8888_esp) \
+    X(lv_color_blend_to_argb8888_with_opa_esp) \
+    X(lv_color_blend_to_argb8888_with_mask_esp) \
+    X(lv_color_blend_to_argb8888_mix_mask_opa_esp) \
+    X(lv_rgb565_blend_normal_to_rgb565_esp) \
+    X(lv_rgb565_blend_normal_to_rgb565_with_opa_esp) \
+    X(lv_rgb565_blend_normal_to_rgb565_with_mask_esp) \
+    X(lv_rgb565_blend_normal_to_rgb565_mix_mask_opa_esp) \
+    X(lv_argb8888_blend_normal_to_rgb565_esp) \
+    X(lv_argb8888_blend_normal_to_rgb565_with_opa_esp) \
+    X(lv_argb8888_blend_normal_to_rgb565_with_mask_esp) \
+    X(lv_argb8888_blend_normal_to_rgb565_mix_mask_opa_esp) \
+    X(lv_argb8888_blend_normal_to_argb8888_esp) \
+    X(lv_argb8888_blend_normal_to_argb8888_with_opa_esp) \
+    X(lv_argb8888_blend_normal_to_argb8888_with_mask_esp) \
+    X(lv_argb8888_blend_normal_to_argb8888_mix_mask_opa_esp) \
+    TEST_ASM_FUNCS_L8_AL88(X)
+
+#define TEST_ASM_ENUM(name)     TEST_ASM_##name,
+#define TEST_ASM_NAME(name)     #name,
+#define TEST_ASM_WRAPPER(name) \
+    int __real_##name(void *asm_dsc); \
+    int __wrap_##name(void *asm_dsc) \
+    { \
+        asm_calls[TEST_ASM_##name]++; \
+        return __real_##name(asm_dsc); \
+    }
+
+typedef enum {
+    TEST_ASM_FUNCS(TEST_ASM_ENUM)
+    TEST_ASM_COUNT
+} test_asm_func_t;
+
+#if TEST_ASM_L8_AL88
+#define TEST_ASM_CHECKED_COUNT  (TEST_ASM_COUNT)
+#else
+#define TEST_ASM_CHECKED_COUNT  (TEST_ASM_lv_l8_blend_normal_to_rgb565_esp)
+#endif
+
+static const char *TAG = "test asm";
+static const char *asm_names[TEST_ASM_COUNT] = {TEST_ASM_FUNCS(TEST_ASM_NAME)};
+
+/* Call counters of the wrapped assembly functions */
+static uint32_t asm_calls[TEST_ASM_COUNT];
+
+TEST_ASM_FUNCS(TEST_ASM_WRAPPER)
+
+/* Image data, big enough for all the color formats */
+static uint8_t test_img_data[TEST_IMG_SIZE * TEST_IMG_SIZE * 4];
+
+static void test_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
+{
+    lv_display_flush_ready(disp);
+}
+
+/* Four images of one color format: plain, with opacity, with rounded corners (mask) and with both */
+static void test_add_images(lv_obj_t *scr, const lv_image_dsc_t *img_dsc, int32_t y)
+{
+    for (int i = 0; i < 4; i++) {
+        lv_obj_t *img = lv_image_create(scr);
+        lv_image_set_src(img, img_dsc);
+        lv_obj_set_pos(img, 4 + i * (TEST_IMG_SIZE + 4), y);
+        if (i & 1) {
+            lv_obj_set_style_image_opa(img, LV_OPA_50, 0);
+        }
+        if (i & 2) {
+            lv_obj_set_style_radius(img, TEST_IMG_RADIUS, 0);
+            lv_obj_set_style_clip_corner(img, true, 0);
+        }
+    }
+}
+
+/* Background, plain, semi-transparent and rounded rectangles (fills with opacity and mask), text and images */
+static void test_render(lv_color_format_t disp_cf, const lv_color_format_t *img_cfs, size_t img_cfs_count)
+{
+    const size_t buf_size = TEST_DISP_H_RES * TEST_DISP_V_RES * lv_color_format_get_size(disp_cf);
+    void *buf = malloc(buf_size);
+    TEST_ASSERT_NOT_NULL(buf);
+
+    lvgl_port_lock(0);
+
+    lv_display_t *disp = lv_display_create(TEST_DISP_H_RES, TEST_DISP_V_RES);
+    TEST_ASSERT_NOT_NULL(disp);
+    lv_display_set_color_format(disp, disp_cf);
+    lv_display_set_flush_cb(disp, test_flush_cb);
+    lv_display_set_buffers(disp, buf, NULL, buf_size, LV_DISPLAY_RENDER_MODE_FULL);
+
+    lv_obj_t *scr = lv_display_get_screen_active(disp);
+    lv_obj_set_style_bg_color(scr, lv_color_hex(0x203040), 0);
+    lv_obj_set_style_bg_opa(scr, LV_OPA_COVER, 0);
+
+    for (int i = 0; i < 3; i++) {
+        lv_obj_t *rect = lv_obj_create(scr);
+        lv_obj_set_size(rect, TEST_DISP_H_RES / 4, TEST_DISP_V_RES / 4);
+        lv_obj_set_style_radius(rect, (i == 0 ? 0 : TEST_DISP_V_RES / 8), 0);
+        lv_obj_set_style_border_width(rect, 0, 0);
+        lv_obj_set_style_bg_color(rect, lv_color_hex(0xF0A000), 0);
+        lv_obj_set_style_bg_opa(rect, (i == 1 ? LV_OPA_COVER : LV_OPA_50), 0);
+        lv_obj_align(rect, LV_ALIGN_TOP_RIGHT, 0, i * (TEST_DISP_V_RES / 4 + 2));
+    }
+
+    lv_obj_t *label = lv_label_create(scr);
+    lv_label_set_text(label, "Assembly render");
+    lv_obj_align(label, LV_ALIGN_BOTTOM_RIGHT, 0, 0);
+
+    lv_image_dsc_t img_dscs[4];
+    TEST_ASSERT_LESS_OR_EQUAL(sizeof(img_dscs) / sizeof(img_dscs[0]), img_cfs_count);
+    for (size_t i = 0; i < img_cfs_count; i++) {
+        const uint32_t px_size = lv_color_format_get_size(img_cfs[i]);
+        img_dscs[i] = (lv_image_dsc_t) {
+            .header.magic = LV_IMAGE_HEADER_MAGIC,
+            .header.cf = img_cfs[i],
+            .header.w = TEST_IMG_SIZE,
+            .header.h = TEST_IMG_SIZE,
+            .header.stride = TEST_IMG_SIZE * px_size,
+            .data_size = TEST_IMG_SIZE * TEST_IMG_SIZE * px_size,
+            .data = test_img_data,
+        };
+        test_add_images(scr, &img_dscs[i], 4 + i * (TEST_IMG_SIZE + 4));
+    }
+
+    lv_obj_invalidate(scr);
+    lv_refr_now(disp);
+
+    lv_display_delete(disp);
+    lvgl_port_unlock();
+
+    free(buf);
+}
+
+TEST_CASE("LVGL port assembly render is used", "[lvgl port][asm]")
+{
+    const lvgl_port_cfg_t lvgl_cfg = ESP_LVGL_PORT_INIT_CONFIG();
+    TEST_ASSERT_EQUAL(ESP_OK, lvgl_port_init(&lvgl_cfg));
+
+    for (size_t i = 0; i < sizeof(test_img_data); i++) {
+        test_img_data[i] = (uint8_t)rand();
+    }
+    memset(asm_calls, 0, sizeof(asm_calls));
+
+    const lv_color_format_t rgb565_img_cfs[] = {
+        LV_COLOR_FORMAT_RGB565,
+        LV_COLOR_FORMAT_ARGB8888,
+#if TEST_ASM_L8_AL88
+        LV_COLOR_FORMAT_L8,
+        LV_COLOR_FORMAT_AL88,
+#endif
+    };
+    test_render(LV_COLOR_FORMAT_RGB565, rgb565_img_cfs, sizeof(rgb565_img_cfs) / sizeof(rgb565_img_cfs[0]));
+
+    const lv_color_format_t argb8888_img_cfs[] = {
+        LV_COLOR_FORMAT_ARGB8888,
+    };
+    test_render(LV_COLOR_FORMAT_ARGB8888, argb8888_img_cfs, sizeof(argb8888_img_cfs) / sizeof(argb8888_img_cfs[0]));
+
+    TEST_ASSERT_EQUAL(ESP_OK, lvgl_port_deinit());
+
+    for (int i = 0; i < TEST_ASM_COUNT; i++) {
+        ESP_LOGI(TAG, "%s: %"PRIu32" calls", asm_names[i], asm_calls[i]);
+    }
+    for (int i = 0; i < TEST_ASM_CHECKED_COUNT; i++) {
+        TEST_ASSERT_GREATER_THAN_UINT32_MESSAGE(0, asm_calls[i], asm_names[i]);
+    }
+}
+
+#endif // CONFIG_LV_DRAW_SW_ASM_CUSTOM && CONFIG_LVGL_PORT_ASM_BLEND_EXPERIMENTAL && (CONFIG_IDF_TARGET_ESP32 || CONFIG_IDF_TARGET_ESP32S3)
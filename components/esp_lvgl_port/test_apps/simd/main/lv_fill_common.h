@@ -8,6 +8,7 @@
 
 #include "esp_err.h"
 #include <stdint.h>
+#include <stdbool.h>
 #include "lv_color.h"
 #include "lv_draw_sw_blend.h"
 
@@ -41,6 +42,7 @@ typedef struct {
         void *p_ansi;                                       // pointer to the working ANSI test buf
         void *p_asm_alloc;                                  // pointer to the beginning of the memory allocated for ASM test buf, used in free()
         void *p_ansi_alloc;                                 // pointer to the beginning of the memory allocated for ANSI test buf, used in free()
+        lv_opa_t *p_mask;                                   // pointer to the mask buf, NULL if the mask is not used
     } buf;
     void (*blend_api_func)(_lv_draw_sw_blend_fill_dsc_t *); // pointer to LVGL API function
     lv_color_format_t color_format;                         // LV color format
@@ -51,6 +53,8 @@ typedef struct {
     unsigned int dest_h;                                    // Destination buffer height
     unsigned int dest_stride;                               // Destination buffer stride
     unsigned int unalign_byte;                              // Destination buffer memory unalignment
+    lv_opa_t opa;                                           // Opacity of the fill
+    bool use_mask;                                          // Fill with mask, mask stride is the same as destination stride (in pixels)
 } func_test_case_params_t;
 
 /**
@@ -65,6 +69,8 @@ typedef struct {
     unsigned int benchmark_cycles;                          // Count of benchmark cycles
     void *array_align16;                                    // test array with 16 byte alignment - testing most ideal case
     void *array_align1;                                     // test array with 1 byte alignment - testing wort case
+    const lv_opa_t *mask_buf;                               // mask array (width * height), NULL if the mask is not used
+    lv_opa_t opa;                                           // Opacity of the fill
     void (*blend_api_func)(_lv_draw_sw_blend_fill_dsc_t *); // pointer to LVGL API function
 } bench_test_case_params_t;
 
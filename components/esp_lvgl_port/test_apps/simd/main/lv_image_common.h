@@ -0,0 +1,36 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "lv_color.h"
+#include "lv_draw_sw_blend.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ------------------------------------------------- Macros and Types --------------------------------------------------
+
+/**
+ * @brief Image blend test case parameters
+ */
+typedef struct {
+    void (*blend_api_func)(_lv_draw_sw_blend_image_dsc_t *);    // pointer to LVGL API function
+    lv_color_format_t src_color_format;                         // LV color format of the source image
+    size_t src_px_size;                                         // Size of source pixel in bytes
+    lv_color_format_t dest_color_format;                        // LV color format of the destination buffer
+    size_t dest_px_size;                                        // Size of destination pixel in bytes
+    lv_opa_t opa;                                               // Opacity of the image
+    bool use_mask;                                              // Blend with mask
+} image_test_case_params_t;
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
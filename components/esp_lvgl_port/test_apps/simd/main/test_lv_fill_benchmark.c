@@ -6,6 +6,7 @@
 
 #include <string.h>
 #include <malloc.h>
+#include <stdlib.h>
 #include <sdkconfig.h>
 
 #include "unity.h"
@@ -21,6 +22,7 @@
 #define STRIDE WIDTH
 #define UNALIGN_BYTES 1
 #define BENCHMARK_CYCLES 1000
+#define TEST_OPA 100            // Opacity used for the fill with opacity
 
 // ------------------------------------------------- Macros and Types --------------------------------------------------
 
@@ -39,6 +41,15 @@ static lv_color_t test_color = {
  */
 static void lv_fill_benchmark_init(bench_test_case_params_t *test_params);
 
+/**
+ * @brief Initialize and run the benchmark test of the fill with opacity and/or mask
+ *
+ * @param[in] color_format LV color format (ARGB8888 or RGB565)
+ * @param[in] opa Opacity of the fill
+ * @param[in] use_mask Fill with mask
+ */
+static void lv_fill_mix_benchmark(lv_color_format_t color_format, lv_opa_t opa, bool use_mask);
+
 /**
  * @brief Run the benchmark test
  */
@@ -63,6 +74,8 @@ Procedure:
     - Count how many CPU cycles does it take to run a function from the LVGL blending API for each case (ideal and worst case)
     - Run ansi version of LVGL blending API multiple times (1000-times or so) and repeat the 2 above steps for the ansi version
     - Free test arrays and structures needed for LVGL blending API
+    - Fill with opacity and/or mask is benchmarked the same way, the destination array is filled with opaque background
+      and the mask contains a gradient
 */
 // ------------------------------------------------ Test cases stages --------------------------------------------------
 
@@ -84,6 +97,8 @@ TEST_CASE("LV Fill benchmark ARGB8888", "[fill][benchmark][ARGB8888]")
         .array_align16 = (void *)dest_array_align16,
         .array_align1 = (void *)dest_array_align1,
         .blend_api_func = &lv_draw_sw_blend_color_to_argb8888,
+        .mask_buf = NULL,
+        .opa = LV_OPA_MAX,
     };
 
     ESP_LOGI(TAG_LV_FILL_BENCH, "running test for ARGB8888 color format");
@@ -109,14 +124,92 @@ TEST_CASE("LV Fill benchmark RGB565", "[fill][benchmark][RGB565]")
         .array_align16 = (void *)dest_array_align16,
         .array_align1 = (void *)dest_array_align1,
         .blend_api_func = &lv_draw_sw_blend_color_to_rgb565,
+        .mask_buf = NULL,
+        .opa = LV_OPA_MAX,
     };
 
     ESP_LOGI(TAG_LV_FILL_BENCH, "running test for RGB565 color format");
     lv_fill_benchmark_init(&test_params);
     free(dest_array_align16);
 }
+
+TEST_CASE("LV Fill benchmark ARGB8888 with opacity", "[fill][benchmark][ARGB8888][opa]")
+{
+    ESP_LOGI(TAG_LV_FILL_BENCH, "running test for ARGB8888 color format with opacity");
+    lv_fill_mix_benchmark(LV_COLOR_FORMAT_ARGB8888, TEST_OPA, false);
+}
+
+TEST_CASE("LV Fill benchmark ARGB8888 with mask", "[fill][benchmark][ARGB8888][mask]")
+{
+    ESP_LOGI(TAG_LV_FILL_BENCH, "running test for ARGB8888 color format with mask");
+    lv_fill_mix_benchmark(LV_COLOR_FORMAT_ARGB8888, LV_OPA_MAX, true);
+}
+
+TEST_CASE("LV Fill benchmark ARGB8888 with mask and opacity", "[fill][benchmark][ARGB8888][mask_opa]")
+{
+    ESP_LOGI(TAG_LV_FILL_BENCH, "running test for ARGB8888 color format with mask and opacity");
+    lv_fill_mix_benchmark(LV_COLOR_FORMAT_ARGB8888, TEST_OPA, true);
+}
+
+TEST_CASE("LV Fill benchmark RGB565 with opacity", "[fill][benchmark][RGB565][opa]")
+{
+    ESP_LOGI(TAG_LV_FILL_BENCH, "running test for RGB565 color format with opacity");
+    lv_fill_mix_benchmark(LV_COLOR_FORMAT_RGB565, TEST_OPA, false);
+}
+
+TEST_CASE("LV Fill benchmark RGB565 with mask", "[fill][benchmark][RGB565][mask]")
+{
+    ESP_LOGI(TAG_LV_FILL_BENCH, "running test for RGB565 color format with mask");
+    lv_fill_mix_benchmark(LV_COLOR_FORMAT_RGB565, LV_OPA_MAX, true);
+}
+
+TEST_CASE("LV Fill benchmark RGB565 with mask and opacity", "[fill][benchmark][RGB565][mask_opa]")
+{
+    ESP_LOGI(TAG_LV_FILL_BENCH, "running test for RGB565 color format with mask and opacity");
+    lv_fill_mix_benchmark(LV_COLOR_FORMAT_RGB565, TEST_OPA, true);
+}
+
 // ------------------------------------------------ Static test functions ----------------------------------------------
 
+static void lv_fill_mix_benchmark(lv_color_format_t color_format, lv_opa_t opa, bool use_mask)
+{
+    const bool argb8888 = (color_format == LV_COLOR_FORMAT_ARGB8888);
+    const size_t data_type_size = argb8888 ? sizeof(uint32_t) : sizeof(uint16_t);
+
+    uint8_t *dest_array_align16 = (uint8_t *)memalign(16, (STRIDE * HEIGHT + UNALIGN_BYTES) * data_type_size);
+    TEST_ASSERT_NOT_EQUAL(NULL, dest_array_align16);
+
+    // Opaque background, mixing depends on the destination
+    memset(dest_array_align16, 0xFF, (STRIDE * HEIGHT + UNALIGN_BYTES) * data_type_size);
+
+    lv_opa_t *mask_array = NULL;
+    if (use_mask) {
+        mask_array = (lv_opa_t *)malloc(WIDTH * HEIGHT);
+        TEST_ASSERT_NOT_EQUAL(NULL, mask_array);
+        for (int i = 0; i < WIDTH * HEIGHT; i++) {
+            mask_array[i] = (lv_opa_t)(i % WIDTH * 255 / (WIDTH - 1));
+        }
+    }
+
+    bench_test_case_params_t test_params = {
+        .height = HEIGHT,
+        .width = WIDTH,
+        .stride = STRIDE * data_type_size,
+        .cc_height = HEIGHT - 1,
+        .cc_width = WIDTH - 1,
+        .benchmark_cycles = BENCHMARK_CYCLES,
+        .array_align16 = (void *)dest_array_align16,
+        .array_align1 = (void *)(dest_array_align16 + UNALIGN_BYTES * data_type_size),   // Apply unalignment for the worst-case test scenario
+        .blend_api_func = argb8888 ? &lv_draw_sw_blend_color_to_argb8888 : &lv_draw_sw_blend_color_to_rgb565,
+        .mask_buf = mask_array,
+        .opa = opa,
+    };
+
+    lv_fill_benchmark_init(&test_params);
+    free(mask_array);
+    free(dest_array_align16);
+}
+
 static void lv_fill_benchmark_init(bench_test_case_params_t *test_params)
 {
     // Init structure for LVGL blend API, to call the Assembly API
@@ -125,9 +218,10 @@ static void lv_fill_benchmark_init(bench_test_case_params_t *test_params)
         .dest_w = test_params->width,
         .dest_h = test_params->height,
         .dest_stride = test_params->stride,  // stride * sizeof()
-        .mask_buf = NULL,
+        .mask_buf = test_params->mask_buf,
+        .mask_stride = test_params->width,
         .color = test_color,
-        .opa = LV_OPA_MAX,
+        .opa = test_params->opa,
         .use_asm = true,
     };
 
@@ -5,6 +5,7 @@
  */
 
 #include <string.h>
+#include <stdlib.h>
 #include <malloc.h>
 #include <inttypes.h>
 #include "unity.h"
@@ -18,6 +19,7 @@
 
 #define DBG_PRINT_OUTPUT false
 #define CANARY_BYTES 4
+#define TEST_OPA 100            // Opacity used for the fill with opacity
 
 // ------------------------------------------------- Macros and Types --------------------------------------------------
 
@@ -117,6 +119,7 @@ TEST_CASE("Test fill functionality ARGB8888", "[fill][functionality][ARGB8888]")
         .blend_api_func = &lv_draw_sw_blend_color_to_argb8888,
         .color_format = LV_COLOR_FORMAT_ARGB8888,
         .data_type_size = sizeof(uint32_t),
+        .opa = LV_OPA_MAX,
     };
 
     ESP_LOGI(TAG_LV_FILL_FUNC, "running test for ARGB8888 color format");
@@ -141,12 +144,169 @@ TEST_CASE("Test fill functionality RGB565", "[fill][functionality][RGB565]")
         .blend_api_func = &lv_draw_sw_blend_color_to_rgb565,
         .color_format = LV_COLOR_FORMAT_RGB565,
         .data_type_size = sizeof(uint16_t),
+        .opa = LV_OPA_MAX,
     };
 
     ESP_LOGI(TAG_LV_FILL_FUNC, "running test for RGB565 color format");
     functionality_test_matrix(&test_matrix, &test_case);
 }
 
+TEST_CASE("Test fill functionality ARGB8888 with opacity", "[fill][functionality][ARGB8888][opa]")
+{
+    test_matrix_params_t test_matrix = {
+        .min_w = 1,             // no lower limit, the same implementation is used for all the widths
+        .min_h = 1,
+        .max_w = 16,
+        .max_h = 16,
+        .min_unalign_byte = 0,
+        .max_unalign_byte = 16,
+        .unalign_step = sizeof(uint32_t),     // LVGL draw buffers are always aligned to the pixel size
+        .dest_stride_step = 1,
+        .test_combinations_count = 0,
+    };
+
+    func_test_case_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_color_to_argb8888,
+        .color_format = LV_COLOR_FORMAT_ARGB8888,
+        .data_type_size = sizeof(uint32_t),
+        .opa = TEST_OPA,
+        .use_mask = false,
+    };
+
+    ESP_LOGI(TAG_LV_FILL_FUNC, "running test for ARGB8888 color format with opacity");
+    functionality_test_matrix(&test_matrix, &test_case);
+}
+
+TEST_CASE("Test fill functionality ARGB8888 with mask", "[fill][functionality][ARGB8888][mask]")
+{
+    test_matrix_params_t test_matrix = {
+        .min_w = 1,             // no lower limit, the same implementation is used for all the widths
+        .min_h = 1,
+        .max_w = 16,
+        .max_h = 16,
+        .min_unalign_byte = 0,
+        .max_unalign_byte = 16,
+        .unalign_step = sizeof(uint32_t),     // LVGL draw buffers are always aligned to the pixel size
+        .dest_stride_step = 1,
+        .test_combinations_count = 0,
+    };
+
+    func_test_case_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_color_to_argb8888,
+        .color_format = LV_COLOR_FORMAT_ARGB8888,
+        .data_type_size = sizeof(uint32_t),
+        .opa = LV_OPA_MAX,
+        .use_mask = true,
+    };
+
+    ESP_LOGI(TAG_LV_FILL_FUNC, "running test for ARGB8888 color format with mask");
+    functionality_test_matrix(&test_matrix, &test_case);
+}
+
+TEST_CASE("Test fill functionality ARGB8888 with mask and opacity", "[fill][functionality][ARGB8888][mask_opa]")
+{
+    test_matrix_params_t test_matrix = {
+        .min_w = 1,             // no lower limit, the same implementation is used for all the widths
+        .min_h = 1,
+        .max_w = 16,
+        .max_h = 16,
+        .min_unalign_byte = 0,
+        .max_unalign_byte = 16,
+        .unalign_step = sizeof(uint32_t),     // LVGL draw buffers are always aligned to the pixel size
+        .dest_stride_step = 1,
+        .test_combinations_count = 0,
+    };
+
+    func_test_case_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_color_to_argb8888,
+        .color_format = LV_COLOR_FORMAT_ARGB8888,
+        .data_type_size = sizeof(uint32_t),
+        .opa = TEST_OPA,
+        .use_mask = true,
+    };
+
+    ESP_LOGI(TAG_LV_FILL_FUNC, "running test for ARGB8888 color format with mask and opacity");
+    functionality_test_matrix(&test_matrix, &test_case);
+}
+
+TEST_CASE("Test fill functionality RGB565 with opacity", "[fill][functionality][RGB565][opa]")
+{
+    test_matrix_params_t test_matrix = {
+        .min_w = 1,             // no lower limit, the same implementation is used for all the widths
+        .min_h = 1,
+        .max_w = 16,
+        .max_h = 16,
+        .min_unalign_byte = 0,
+        .max_unalign_byte = 16,
+        .unalign_step = sizeof(uint16_t),     // LVGL draw buffers are always aligned to the pixel size
+        .dest_stride_step = 1,
+        .test_combinations_count = 0,
+    };
+
+    func_test_case_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_color_to_rgb565,
+        .color_format = LV_COLOR_FORMAT_RGB565,
+        .data_type_size = sizeof(uint16_t),
+        .opa = TEST_OPA,
+        .use_mask = false,
+    };
+
+    ESP_LOGI(TAG_LV_FILL_FUNC, "running test for RGB565 color format with opacity");
+    functionality_test_matrix(&test_matrix, &test_case);
+}
+
+TEST_CASE("Test fill functionality RGB565 with mask", "[fill][functionality][RGB565][mask]")
+{
+    test_matrix_params_t test_matrix = {
+        .min_w = 1,             // no lower limit, the same implementation is used for all the widths
+        .min_h = 1,
+        .max_w = 16,
+        .max_h = 16,
+        .min_unalign_byte = 0,
+        .max_unalign_byte = 16,
+        .unalign_step = sizeof(uint16_t),     // LVGL draw buffers are always aligned to the pixel size
+        .dest_stride_step = 1,
+        .test_combinations_count = 0,
+    };
+
+    func_test_case_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_color_to_rgb565,
+        .color_format = LV_COLOR_FORMAT_RGB565,
+        .data_type_size = sizeof(uint16_t),
+        .opa = LV_OPA_MAX,
+        .use_mask = true,
+    };
+
+    ESP_LOGI(TAG_LV_FILL_FUNC, "running test for RGB565 color format with mask");
+    functionality_test_matrix(&test_matrix, &test_case);
+}
+
+TEST_CASE("Test fill functionality RGB565 with mask and opacity", "[fill][functionality][RGB565][mask_opa]")
+{
+    test_matrix_params_t test_matrix = {
+        .min_w = 1,             // no lower limit, the same implementation is used for all the widths
+        .min_h = 1,
+        .max_w = 16,
+        .max_h = 16,
+        .min_unalign_byte = 0,
+        .max_unalign_byte = 16,
+        .unalign_step = sizeof(uint16_t),     // LVGL draw buffers are always aligned to the pixel size
+        .dest_stride_step = 1,
+        .test_combinations_count = 0,
+    };
+
+    func_test_case_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_color_to_rgb565,
+        .color_format = LV_COLOR_FORMAT_RGB565,
+        .data_type_size = sizeof(uint16_t),
+        .opa = TEST_OPA,
+        .use_mask = true,
+    };
+
+    ESP_LOGI(TAG_LV_FILL_FUNC, "running test for RGB565 color format with mask and opacity");
+    functionality_test_matrix(&test_matrix, &test_case);
+}
+
 // ------------------------------------------------ Static test functions ----------------------------------------------
 
 static void functionality_test_matrix(test_matrix_params_t *test_matrix, func_test_case_params_t *test_case)
@@ -184,9 +344,10 @@ static void lv_fill_functionality(func_test_case_params_t *test_case)
         .dest_w = test_case->dest_w,
         .dest_h = test_case->dest_h,
         .dest_stride = test_case->dest_stride * test_case->data_type_size,  // stride * sizeof()
-        .mask_buf = NULL,
+        .mask_buf = test_case->buf.p_mask,
+        .mask_stride = test_case->dest_stride,
         .color = test_color,
-        .opa = LV_OPA_MAX,
+        .opa = test_case->opa,
         .use_asm = true,
     };
 
@@ -203,7 +364,7 @@ static void lv_fill_functionality(func_test_case_params_t *test_case)
     test_case->buf.p_ansi -= CANARY_BYTES * test_case->data_type_size;
 
     // Evaluate the results
-    sprintf(test_msg_buf, "Test case: dest_w = %d, dest_h = %d, dest_stride = %d, unalign_byte = %d\n", test_case->dest_w, test_case->dest_h, test_case->dest_stride, test_case->unalign_byte);
+    sprintf(test_msg_buf, "Test case: dest_w = %d, dest_h = %d, dest_stride = %d, unalign_byte = %d, opa = %d, mask = %d\n", test_case->dest_w, test_case->dest_h, test_case->dest_stride, test_case->unalign_byte, test_case->opa, test_case->use_mask);
 
     switch (test_case->color_format) {
     case LV_COLOR_FORMAT_ARGB8888: {
@@ -222,6 +383,7 @@ static void lv_fill_functionality(func_test_case_params_t *test_case)
 
     free(test_case->buf.p_asm_alloc);
     free(test_case->buf.p_ansi_alloc);
+    free(test_case->buf.p_mask);
 
 }
 
@@ -257,6 +419,27 @@ static void fill_test_bufs(func_test_case_params_t *test_case)
         dest_buf_ansi[i * data_type_size] = (uint8_t)(i % 255);
     }
 
+    // Mixing depends on the destination, fill all the bytes of the actual part of the destination buffers with random values
+    // ARGB8888: every other pixel is opaque, to test mixing with opaque and transparent background
+    if (test_case->opa < LV_OPA_MAX || test_case->use_mask) {
+        for (int i = CANARY_BYTES * data_type_size; i < (active_buf_len + CANARY_BYTES) * data_type_size; i++) {
+            const bool opaque = (test_case->color_format == LV_COLOR_FORMAT_ARGB8888) && ((i % 8) == 3);
+            dest_buf_asm[i] = opaque ? 0xFF : (uint8_t)rand();
+            dest_buf_ansi[i] = dest_buf_asm[i];
+        }
+    }
+
+    // Allocate and fill the mask, include fully transparent and fully opaque values
+    test_case->buf.p_mask = NULL;
+    if (test_case->use_mask) {
+        const size_t mask_len = test_case->dest_h * test_case->dest_stride;
+        test_case->buf.p_mask = malloc(mask_len);
+        TEST_ASSERT_NOT_NULL_MESSAGE(test_case->buf.p_mask, "Lack of memory");
+        for (int i = 0; i < mask_len; i++) {
+            test_case->buf.p_mask[i] = ((i % 4) == 0) ? LV_OPA_COVER : ((i % 5) == 0) ? LV_OPA_TRANSP : (lv_opa_t)rand();
+        }
+    }
+
     // Shift array pointers by Canary Bytes amount
     dest_buf_asm += CANARY_BYTES * data_type_size;
     dest_buf_ansi += CANARY_BYTES * data_type_size;
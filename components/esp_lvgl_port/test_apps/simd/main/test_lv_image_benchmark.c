@@ -0,0 +1,330 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <malloc.h>
+#include <inttypes.h>
+#include <sdkconfig.h>
+
+#include "unity.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"  // for xthal_get_ccount()
+#include "lv_image_common.h"
+#include "lv_draw_sw_blend.h"
+#include "lv_draw_sw_blend_to_argb8888.h"
+#include "lv_draw_sw_blend_to_rgb565.h"
+
+#define WIDTH 128
+#define HEIGHT 128
+#define UNALIGN_PX 1
+#define BENCHMARK_CYCLES 1000
+#define TEST_OPA 100            // Opacity used for the blend with opacity
+
+// ------------------------------------------------- Macros and Types --------------------------------------------------
+
+static const char *TAG_LV_IMAGE_BENCH = "LV Image Benchmark";
+static const char *asm_ansi_func[] = {"ASM", "ANSI"};
+
+// ------------------------------------------------ Static function headers --------------------------------------------
+
+/**
+ * @brief Initialize and run the benchmark test
+ *
+ * @param[in] test_case Pointer to structure defining image blend test case
+ */
+static void lv_image_benchmark_init(const image_test_case_params_t *test_case);
+
+/**
+ * @brief Run the benchmark test
+ */
+static float lv_image_benchmark_run(const image_test_case_params_t *test_case, _lv_draw_sw_blend_image_dsc_t *dsc);
+
+// ------------------------------------------------ Test cases ---------------------------------------------------------
+
+/*
+Benchmark tests
+
+Requires:
+    - To pass functionality tests first
+
+Purpose:
+    - Test that an acceleration is achieved by an assembly implementation of LVGL image blending API
+
+Procedure:
+    - Initialize source image, destination and mask arrays
+    - Run assembly version of LVGL image blending API multiple times (1000-times or so)
+    - Firstly use an input test parameters for the most ideal case (16-byte aligned arrays, even image width)
+    - Then use worst-case input test parameters (source and destination unaligned by 1 pixel, odd image width and height)
+    - Count how many CPU cycles does it take to run a function from the LVGL blending API for each case (ideal and worst case)
+    - Run ansi version of LVGL image blending API multiple times (1000-times or so) and repeat the 2 above steps for the ansi version
+    - Free test arrays
+*/
+// ------------------------------------------------ Test cases stages --------------------------------------------------
+
+TEST_CASE("LV Image benchmark RGB565 to RGB565", "[image][benchmark][RGB565]")
+{
+    const image_test_case_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_image_to_rgb565,
+        .src_color_format = LV_COLOR_FORMAT_RGB565,
+        .src_px_size = sizeof(uint16_t),
+        .dest_color_format = LV_COLOR_FORMAT_RGB565,
+        .dest_px_size = sizeof(uint16_t),
+        .opa = LV_OPA_MAX,
+        .use_mask = false,
+    };
+
+    ESP_LOGI(TAG_LV_IMAGE_BENCH, "running test for RGB565 to RGB565");
+    lv_image_benchmark_init(&test_case);
+}
+
+TEST_CASE("LV Image benchmark RGB565 to RGB565 with opacity", "[image][benchmark][RGB565][opa]")
+{
+    const image_test_case_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_image_to_rgb565,
+        .src_color_format = LV_COLOR_FORMAT_RGB565,
+        .src_px_size = sizeof(uint16_t),
+        .dest_color_format = LV_COLOR_FORMAT_RGB565,
+        .dest_px_size = sizeof(uint16_t),
+        .opa = TEST_OPA,
+        .use_mask = false,
+    };
+
+    ESP_LOGI(TAG_LV_IMAGE_BENCH, "running test for RGB565 to RGB565 with opacity");
+    lv_image_benchmark_init(&test_case);
+}
+
+TEST_CASE("LV Image benchmark RGB565 to RGB565 with mask", "[image][benchmark][RGB565][mask]")
+{
+    const image_test_case_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_image_to_rgb565,
+        .src_color_format = LV_COLOR_FORMAT_RGB565,
+        .src_px_size = sizeof(uint16_t),
+        .dest_color_format = LV_COLOR_FORMAT_RGB565,
+        .dest_px_size = sizeof(uint16_t),
+        .opa = LV_OPA_MAX,
+        .use_mask = true,
+    };
+
+    ESP_LOGI(TAG_LV_IMAGE_BENCH, "running test for RGB565 to RGB565 with mask");
+    lv_image_benchmark_init(&test_case);
+}
+
+TEST_CASE("LV Image benchmark ARGB8888 to RGB565", "[image][benchmark][RGB565]")
+{
+    const image_test_case_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_image_to_rgb565,
+        .src_color_format = LV_COLOR_FORMAT_ARGB8888,
+        .src_px_size = sizeof(uint32_t),
+        .dest_color_format = LV_COLOR_FORMAT_RGB565,
+        .dest_px_size = sizeof(uint16_t),
+        .opa = LV_OPA_MAX,
+        .use_mask = false,
+    };
+
+    ESP_LOGI(TAG_LV_IMAGE_BENCH, "running test for ARGB8888 to RGB565");
+    lv_image_benchmark_init(&test_case);
+}
+
+TEST_CASE("LV Image benchmark ARGB8888 to RGB565 with opacity", "[image][benchmark][RGB565][opa]")
+{
+    const image_test_case_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_image_to_rgb565,
+        .src_color_format = LV_COLOR_FORMAT_ARGB8888,
+        .src_px_size = sizeof(uint32_t),
+        .dest_color_format = LV_COLOR_FORMAT_RGB565,
+        .dest_px_size = sizeof(uint16_t),
+        .opa = TEST_OPA,
+        .use_mask = false,
+    };
+
+    ESP_LOGI(TAG_LV_IMAGE_BENCH, "running test for ARGB8888 to RGB565 with opacity");
+    lv_image_benchmark_init(&test_case);
+}
+
+TEST_CASE("LV Image benchmark ARGB8888 to ARGB8888", "[image][benchmark][ARGB8888]")
+{
+    const image_test_case_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_image_to_argb8888,
+        .src_color_format = LV_COLOR_FORMAT_ARGB8888,
+        .src_px_size = sizeof(uint32_t),
+        .dest_color_format = LV_COLOR_FORMAT_ARGB8888,
+        .dest_px_size = sizeof(uint32_t),
+        .opa = LV_OPA_MAX,
+        .use_mask = false,
+    };
+
+    ESP_LOGI(TAG_LV_IMAGE_BENCH, "running test for ARGB8888 to ARGB8888");
+    lv_image_benchmark_init(&test_case);
+}
+
+TEST_CASE("LV Image benchmark ARGB8888 to ARGB8888 with opacity", "[image][benchmark][ARGB8888][opa]")
+{
+    const image_test_case_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_image_to_argb8888,
+        .src_color_format = LV_COLOR_FORMAT_ARGB8888,
+        .src_px_size = sizeof(uint32_t),
+        .dest_color_format = LV_COLOR_FORMAT_ARGB8888,
+        .dest_px_size = sizeof(uint32_t),
+        .opa = TEST_OPA,
+        .use_mask = false,
+    };
+
+    ESP_LOGI(TAG_LV_IMAGE_BENCH, "running test for ARGB8888 to ARGB8888 with opacity");
+    lv_image_benchmark_init(&test_case);
+}
+
+TEST_CASE("LV Image benchmark L8 to RGB565", "[image][benchmark][RGB565]")
+{
+    const image_test_case_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_image_to_rgb565,
+        .src_color_format = LV_COLOR_FORMAT_L8,
+        .src_px_size = sizeof(uint8_t),
+        .dest_color_format = LV_COLOR_FORMAT_RGB565,
+        .dest_px_size = sizeof(uint16_t),
+        .opa = LV_OPA_MAX,
+        .use_mask = false,
+    };
+
+    ESP_LOGI(TAG_LV_IMAGE_BENCH, "running test for L8 to RGB565");
+    lv_image_benchmark_init(&test_case);
+}
+
+TEST_CASE("LV Image benchmark L8 to RGB565 with opacity", "[image][benchmark][RGB565][opa]")
+{
+    const image_test_case_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_image_to_rgb565,
+        .src_color_format = LV_COLOR_FORMAT_L8,
+        .src_px_size = sizeof(uint8_t),
+        .dest_color_format = LV_COLOR_FORMAT_RGB565,
+        .dest_px_size = sizeof(uint16_t),
+        .opa = TEST_OPA,
+        .use_mask = false,
+    };
+
+    ESP_LOGI(TAG_LV_IMAGE_BENCH, "running test for L8 to RGB565 with opacity");
+    lv_image_benchmark_init(&test_case);
+}
+
+TEST_CASE("LV Image benchmark AL88 to RGB565", "[image][benchmark][RGB565]")
+{
+    const image_test_case_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_image_to_rgb565,
+        .src_color_format = LV_COLOR_FORMAT_AL88,
+        .src_px_size = sizeof(uint16_t),
+        .dest_color_format = LV_COLOR_FORMAT_RGB565,
+        .dest_px_size = sizeof(uint16_t),
+        .opa = LV_OPA_MAX,
+        .use_mask = false,
+    };
+
+    ESP_LOGI(TAG_LV_IMAGE_BENCH, "running test for AL88 to RGB565");
+    lv_image_benchmark_init(&test_case);
+}
+
+TEST_CASE("LV Image benchmark AL88 to RGB565 with opacity", "[image][benchmark][RGB565][opa]")
+{
+    const image_test_case_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_image_to_rgb565,
+        .src_color_format = LV_COLOR_FORMAT_AL88,
+        .src_px_size = sizeof(uint16_t),
+        .dest_color_format = LV_COLOR_FORMAT_RGB565,
+        .dest_px_size = sizeof(uint16_t),
+        .opa = TEST_OPA,
+        .use_mask = false,
+    };
+
+    ESP_LOGI(TAG_LV_IMAGE_BENCH, "running test for AL88 to RGB565 with opacity");
+    lv_image_benchmark_init(&test_case);
+}
+
+// ------------------------------------------------ Static test functions ----------------------------------------------
+
+static void lv_image_benchmark_init(const image_test_case_params_t *test_case)
+{
+    const size_t src_len = (WIDTH * HEIGHT + UNALIGN_PX) * test_case->src_px_size;
+    const size_t dest_len = (WIDTH * HEIGHT + UNALIGN_PX) * test_case->dest_px_size;
+
+    uint8_t *src_array = (uint8_t *)memalign(16, src_len);
+    uint8_t *dest_array = (uint8_t *)memalign(16, dest_len);
+    lv_opa_t *mask_array = test_case->use_mask ? (lv_opa_t *)malloc(WIDTH * HEIGHT) : NULL;
+    TEST_ASSERT_NOT_EQUAL(NULL, src_array);
+    TEST_ASSERT_NOT_EQUAL(NULL, dest_array);
+    TEST_ASSERT_TRUE(!test_case->use_mask || mask_array);
+
+    // Random source image, opaque destination and a gradient mask
+    for (int i = 0; i < src_len; i++) {
+        src_array[i] = (uint8_t)rand();
+    }
+    memset(dest_array, 0xFF, dest_len);
+    if (mask_array) {
+        for (int i = 0; i < WIDTH * HEIGHT; i++) {
+            mask_array[i] = (lv_opa_t)(i % WIDTH * 255 / (WIDTH - 1));
+        }
+    }
+
+    // Init structure for LVGL blend API, ideal case
+    _lv_draw_sw_blend_image_dsc_t dsc = {
+        .dest_buf = dest_array,
+        .dest_w = WIDTH,
+        .dest_h = HEIGHT,
+        .dest_stride = WIDTH * test_case->dest_px_size,
+        .mask_buf = mask_array,
+        .mask_stride = WIDTH,
+        .src_buf = src_array,
+        .src_stride = WIDTH * test_case->src_px_size,
+        .src_color_format = test_case->src_color_format,
+        .opa = test_case->opa,
+        .blend_mode = LV_BLEND_MODE_NORMAL,
+        .use_asm = true,
+    };
+
+    // Init structure for LVGL blend API, corner case
+    _lv_draw_sw_blend_image_dsc_t dsc_cc = dsc;
+    dsc_cc.dest_buf = dest_array + UNALIGN_PX * test_case->dest_px_size;
+    dsc_cc.src_buf = src_array + UNALIGN_PX * test_case->src_px_size;
+    dsc_cc.dest_w = WIDTH - 1;
+    dsc_cc.dest_h = HEIGHT - 1;
+
+    // Run benchmark 2 times:
+    // First run using assembly, second run using ANSI
+    for (int i = 0; i < 2; i++) {
+
+        // Run benchmark with the most ideal input parameters
+        float cycles = lv_image_benchmark_run(test_case, &dsc);
+        float per_sample = cycles / ((float)(dsc.dest_w * dsc.dest_h));
+        ESP_LOGI(TAG_LV_IMAGE_BENCH, " %s ideal case: %.3f cycles for %"PRIi32"x%"PRIi32" matrix, %.3f cycles per sample", asm_ansi_func[i], cycles, dsc.dest_w, dsc.dest_h, per_sample);
+
+        // Run benchmark with the corner case input parameters
+        cycles = lv_image_benchmark_run(test_case, &dsc_cc);
+        per_sample = cycles / ((float)(dsc_cc.dest_w * dsc_cc.dest_h));
+        ESP_LOGI(TAG_LV_IMAGE_BENCH, " %s corner case: %.3f cycles for %"PRIi32"x%"PRIi32" matrix, %.3f cycles per sample\n", asm_ansi_func[i], cycles, dsc_cc.dest_w, dsc_cc.dest_h, per_sample);
+
+        // change to ANSI
+        dsc.use_asm = false;
+        dsc_cc.use_asm = false;
+    }
+
+    free(src_array);
+    free(dest_array);
+    free(mask_array);
+}
+
+static float lv_image_benchmark_run(const image_test_case_params_t *test_case, _lv_draw_sw_blend_image_dsc_t *dsc)
+{
+    // Call the DUT function for the first time to init the benchmark test
+    test_case->blend_api_func(dsc);
+
+    const unsigned int start_b = xthal_get_ccount();
+    for (int i = 0; i < BENCHMARK_CYCLES; i++) {
+        test_case->blend_api_func(dsc);
+    }
+    const unsigned int end_b = xthal_get_ccount();
+
+    const float total_b = end_b - start_b;
+    const float cycles = total_b / BENCHMARK_CYCLES;
+    return cycles;
+}
@@ -0,0 +1,496 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <malloc.h>
+#include <inttypes.h>
+#include "unity.h"
+#include "esp_log.h"
+#include "lv_image_common.h"
+#include "lv_draw_sw_blend.h"
+#include "lv_draw_sw_blend_to_argb8888.h"
+#include "lv_draw_sw_blend_to_rgb565.h"
+
+// ------------------------------------------------- Defines -----------------------------------------------------------
+
+#define CANARY_BYTES 16         // Bytes before and after the destination image, they must stay unchanged
+#define MAX_W 24                // Maximal width of the tested image
+#define MAX_H 4                 // Maximal height of the tested image
+#define MAX_UNALIGN_PX 3        // Maximal unalignment of the source and destination buffers in pixels
+#define MAX_STRIDE_PAD_PX 2     // Maximal padding at the end of the row in pixels
+#define TEST_OPA 100            // Opacity used for the blend with opacity
+
+// ------------------------------------------------- Macros and Types --------------------------------------------------
+
+static const char *TAG_LV_IMAGE_FUNC = "LV Image Functionality";
+static char test_msg_buf[160];
+
+// ------------------------------------------------ Static function headers --------------------------------------------
+
+/**
+ * @brief Test all the combinations of width, height, stride and alignment of the source and destination buffers
+ *
+ * @param[in] test_case Pointer to structure defining image blend test case
+ */
+static void lv_image_functionality(const image_test_case_params_t *test_case);
+
+/**
+ * @brief Fill buffer with random values
+ *
+ * - ARGB8888: every other pixel is opaque and every 6-th pixel is transparent, to test mixing with opaque and transparent pixels
+ * - AL88: the same as ARGB8888, for the alpha byte of the pixel
+ * - mask: every 4-th value is LV_OPA_COVER and every 5-th value is LV_OPA_TRANSP
+ */
+static void fill_random(uint8_t *buf, size_t len, lv_color_format_t color_format);
+
+// ------------------------------------------------ Test cases ---------------------------------------------------------
+
+/*
+Functionality tests
+
+Purpose:
+    - Test that an assembly version of LVGL image blending API achieves the same results as the ANSI version
+
+Procedure:
+    - Go through all combinations of width, height, stride padding and alignment of the source and destination buffers
+    - Fill source, destination and mask by random values, destination for assembly and ANSI are the same
+    - Run assembly version of the LVGL blending API
+    - Run ANSI C version of the LVGL blending API
+    - Compare the whole destination buffers, including the stride padding and canary bytes around the image
+*/
+
+TEST_CASE("Test image functionality RGB565 to RGB565", "[image][functionality][RGB565]")
+{
+    const image_test_case_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_image_to_rgb565,
+        .src_color_format = LV_COLOR_FORMAT_RGB565,
+        .src_px_size = sizeof(uint16_t),
+        .dest_color_format = LV_COLOR_FORMAT_RGB565,
+        .dest_px_size = sizeof(uint16_t),
+        .opa = LV_OPA_MAX,
+        .use_mask = false,
+    };
+
+    ESP_LOGI(TAG_LV_IMAGE_FUNC, "running test for RGB565 to RGB565");
+    lv_image_functionality(&test_case);
+}
+
+TEST_CASE("Test image functionality RGB565 to RGB565 with opacity", "[image][functionality][RGB565][opa]")
+{
+    const image_test_case_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_image_to_rgb565,
+        .src_color_format = LV_COLOR_FORMAT_RGB565,
+        .src_px_size = sizeof(uint16_t),
+        .dest_color_format = LV_COLOR_FORMAT_RGB565,
+        .dest_px_size = sizeof(uint16_t),
+        .opa = TEST_OPA,
+        .use_mask = false,
+    };
+
+    ESP_LOGI(TAG_LV_IMAGE_FUNC, "running test for RGB565 to RGB565 with opacity");
+    lv_image_functionality(&test_case);
+}
+
+TEST_CASE("Test image functionality RGB565 to RGB565 with mask", "[image][functionality][RGB565][mask]")
+{
+    const image_test_case_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_image_to_rgb565,
+        .src_color_format = LV_COLOR_FORMAT_RGB565,
+        .src_px_size = sizeof(uint16_t),
+        .dest_color_format = LV_COLOR_FORMAT_RGB565,
+        .dest_px_size = sizeof(uint16_t),
+        .opa = LV_OPA_MAX,
+        .use_mask = true,
+    };
+
+    ESP_LOGI(TAG_LV_IMAGE_FUNC, "running test for RGB565 to RGB565 with mask");
+    lv_image_functionality(&test_case);
+}
+
+TEST_CASE("Test image functionality RGB565 to RGB565 with mask and opacity", "[image][functionality][RGB565][mask_opa]")
+{
+    const image_test_case_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_image_to_rgb565,
+        .src_color_format = LV_COLOR_FORMAT_RGB565,
+        .src_px_size = sizeof(uint16_t),
+        .dest_color_format = LV_COLOR_FORMAT_RGB565,
+        .dest_px_size = sizeof(uint16_t),
+        .opa = TEST_OPA,
+        .use_mask = true,
+    };
+
+    ESP_LOGI(TAG_LV_IMAGE_FUNC, "running test for RGB565 to RGB565 with mask and opacity");
+    lv_image_functionality(&test_case);
+}
+
+TEST_CASE("Test image functionality ARGB8888 to RGB565", "[image][functionality][RGB565]")
+{
+    const image_test_case_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_image_to_rgb565,
+        .src_color_format = LV_COLOR_FORMAT_ARGB8888,
+        .src_px_size = sizeof(uint32_t),
+        .dest_color_format = LV_COLOR_FORMAT_RGB565,
+        .dest_px_size = sizeof(uint16_t),
+        .opa = LV_OPA_MAX,
+        .use_mask = false,
+    };
+
+    ESP_LOGI(TAG_LV_IMAGE_FUNC, "running test for ARGB8888 to RGB565");
+    lv_image_functionality(&test_case);
+}
+
+TEST_CASE("Test image functionality ARGB8888 to RGB565 with opacity", "[image][functionality][RGB565][opa]")
+{
+    const image_test_case_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_image_to_rgb565,
+        .src_color_format = LV_COLOR_FORMAT_ARGB8888,
+        .src_px_size = sizeof(uint32_t),
+        .dest_color_format = LV_COLOR_FORMAT_RGB565,
+        .dest_px_size = sizeof(uint16_t),
+        .opa = TEST_OPA,
+        .use_mask = false,
+    };
+
+    ESP_LOGI(TAG_LV_IMAGE_FUNC, "running test for ARGB8888 to RGB565 with opacity");
+    lv_image_functionality(&test_case);
+}
+
+TEST_CASE("Test image functionality ARGB8888 to RGB565 with mask", "[image][functionality][RGB565][mask]")
+{
+    const image_test_case_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_image_to_rgb565,
+        .src_color_format = LV_COLOR_FORMAT_ARGB8888,
+        .src_px_size = sizeof(uint32_t),
+        .dest_color_format = LV_COLOR_FORMAT_RGB565,
+        .dest_px_size = sizeof(uint16_t),
+        .opa = LV_OPA_MAX,
+        .use_mask = true,
+    };
+
+    ESP_LOGI(TAG_LV_IMAGE_FUNC, "running test for ARGB8888 to RGB565 with mask");
+    lv_image_functionality(&test_case);
+}
+
+TEST_CASE("Test image functionality ARGB8888 to RGB565 with mask and opacity", "[image][functionality][RGB565][mask_opa]")
+{
+    const image_test_case_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_image_to_rgb565,
+        .src_color_format = LV_COLOR_FORMAT_ARGB8888,
+        .src_px_size = sizeof(uint32_t),
+        .dest_color_format = LV_COLOR_FORMAT_RGB565,
+        .dest_px_size = sizeof(uint16_t),
+        .opa = TEST_OPA,
+        .use_mask = true,
+    };
+
+    ESP_LOGI(TAG_LV_IMAGE_FUNC, "running test for ARGB8888 to RGB565 with mask and opacity");
+    lv_image_functionality(&test_case);
+}
+
+TEST_CASE("Test image functionality ARGB8888 to ARGB8888", "[image][functionality][ARGB8888]")
+{
+    const image_test_case_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_image_to_argb8888,
+        .src_color_format = LV_COLOR_FORMAT_ARGB8888,
+        .src_px_size = sizeof(uint32_t),
+        .dest_color_format = LV_COLOR_FORMAT_ARGB8888,
+        .dest_px_size = sizeof(uint32_t),
+        .opa = LV_OPA_MAX,
+        .use_mask = false,
+    };
+
+    ESP_LOGI(TAG_LV_IMAGE_FUNC, "running test for ARGB8888 to ARGB8888");
+    lv_image_functionality(&test_case);
+}
+
+TEST_CASE("Test image functionality ARGB8888 to ARGB8888 with opacity", "[image][functionality][ARGB8888][opa]")
+{
+    const image_test_case_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_image_to_argb8888,
+        .src_color_format = LV_COLOR_FORMAT_ARGB8888,
+        .src_px_size = sizeof(uint32_t),
+        .dest_color_format = LV_COLOR_FORMAT_ARGB8888,
+        .dest_px_size = sizeof(uint32_t),
+        .opa = TEST_OPA,
+        .use_mask = false,
+    };
+
+    ESP_LOGI(TAG_LV_IMAGE_FUNC, "running test for ARGB8888 to ARGB8888 with opacity");
+    lv_image_functionality(&test_case);
+}
+
+TEST_CASE("Test image functionality ARGB8888 to ARGB8888 with mask", "[image][functionality][ARGB8888][mask]")
+{
+    const image_test_case_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_image_to_argb8888,
+        .src_color_format = LV_COLOR_FORMAT_ARGB8888,
+        .src_px_size = sizeof(uint32_t),
+        .dest_color_format = LV_COLOR_FORMAT_ARGB8888,
+        .dest_px_size = sizeof(uint32_t),
+        .opa = LV_OPA_MAX,
+        .use_mask = true,
+    };
+
+    ESP_LOGI(TAG_LV_IMAGE_FUNC, "running test for ARGB8888 to ARGB8888 with mask");
+    lv_image_functionality(&test_case);
+}
+
+TEST_CASE("Test image functionality ARGB8888 to ARGB8888 with mask and opacity", "[image][functionality][ARGB8888][mask_opa]")
+{
+    const image_test_case_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_image_to_argb8888,
+        .src_color_format = LV_COLOR_FORMAT_ARGB8888,
+        .src_px_size = sizeof(uint32_t),
+        .dest_color_format = LV_COLOR_FORMAT_ARGB8888,
+        .dest_px_size = sizeof(uint32_t),
+        .opa = TEST_OPA,
+        .use_mask = true,
+    };
+
+    ESP_LOGI(TAG_LV_IMAGE_FUNC, "running test for ARGB8888 to ARGB8888 with mask and opacity");
+    lv_image_functionality(&test_case);
+}
+
+TEST_CASE("Test image functionality L8 to RGB565", "[image][functionality][RGB565]")
+{
+    const image_test_case_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_image_to_rgb565,
+        .src_color_format = LV_COLOR_FORMAT_L8,
+        .src_px_size = sizeof(uint8_t),
+        .dest_color_format = LV_COLOR_FORMAT_RGB565,
+        .dest_px_size = sizeof(uint16_t),
+        .opa = LV_OPA_MAX,
+        .use_mask = false,
+    };
+
+    ESP_LOGI(TAG_LV_IMAGE_FUNC, "running test for L8 to RGB565");
+    lv_image_functionality(&test_case);
+}
+
+TEST_CASE("Test image functionality L8 to RGB565 with opacity", "[image][functionality][RGB565][opa]")
+{
+    const image_test_case_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_image_to_rgb565,
+        .src_color_format = LV_COLOR_FORMAT_L8,
+        .src_px_size = sizeof(uint8_t),
+        .dest_color_format = LV_COLOR_FORMAT_RGB565,
+        .dest_px_size = sizeof(uint16_t),
+        .opa = TEST_OPA,
+        .use_mask = false,
+    };
+
+    ESP_LOGI(TAG_LV_IMAGE_FUNC, "running test for L8 to RGB565 with opacity");
+    lv_image_functionality(&test_case);
+}
+
+TEST_CASE("Test image functionality L8 to RGB565 with mask", "[image][functionality][RGB565][mask]")
+{
+    const image_test_case_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_image_to_rgb565,
+        .src_color_format = LV_COLOR_FORMAT_L8,
+        .src_px_size = sizeof(uint8_t),
+        .dest_color_format = LV_COLOR_FORMAT_RGB565,
+        .dest_px_size = sizeof(uint16_t),
+        .opa = LV_OPA_MAX,
+        .use_mask = true,
+    };
+
+    ESP_LOGI(TAG_LV_IMAGE_FUNC, "running test for L8 to RGB565 with mask");
+    lv_image_functionality(&test_case);
+}
+
+TEST_CASE("Test image functionality L8 to RGB565 with mask and opacity", "[image][functionality][RGB565][mask_opa]")
+{
+    const image_test_case_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_image_to_rgb565,
+        .src_color_format = LV_COLOR_FORMAT_L8,
+        .src_px_size = sizeof(uint8_t),
+        .dest_color_format = LV_COLOR_FORMAT_RGB565,
+        .dest_px_size = sizeof(uint16_t),
+        .opa = TEST_OPA,
+        .use_mask = true,
+    };
+
+    ESP_LOGI(TAG_LV_IMAGE_FUNC, "running test for L8 to RGB565 with mask and opacity");
+    lv_image_functionality(&test_case);
+}
+
+TEST_CASE("Test image functionality AL88 to RGB565", "[image][functionality][RGB565]")
+{
+    const image_test_case_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_image_to_rgb565,
+        .src_color_format = LV_COLOR_FORMAT_AL88,
+        .src_px_size = sizeof(uint16_t),
+        .dest_color_format = LV_COLOR_FORMAT_RGB565,
+        .dest_px_size = sizeof(uint16_t),
+        .opa = LV_OPA_MAX,
+        .use_mask = false,
+    };
+
+    ESP_LOGI(TAG_LV_IMAGE_FUNC, "running test for AL88 to RGB565");
+    lv_image_functionality(&test_case);
+}
+
+TEST_CASE("Test image functionality AL88 to RGB565 with opacity", "[image][functionality][RGB565][opa]")
+{
+    const image_test_case_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_image_to_rgb565,
+        .src_color_format = LV_COLOR_FORMAT_AL88,
+        .src_px_size = sizeof(uint16_t),
+        .dest_color_format = LV_COLOR_FORMAT_RGB565,
+        .dest_px_size = sizeof(uint16_t),
+        .opa = TEST_OPA,
+        .use_mask = false,
+    };
+
+    ESP_LOGI(TAG_LV_IMAGE_FUNC, "running test for AL88 to RGB565 with opacity");
+    lv_image_functionality(&test_case);
+}
+
+TEST_CASE("Test image functionality AL88 to RGB565 with mask", "[image][functionality][RGB565][mask]")
+{
+    const image_test_case_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_image_to_rgb565,
+        .src_color_format = LV_COLOR_FORMAT_AL88,
+        .src_px_size = sizeof(uint16_t),
+        .dest_color_format = LV_COLOR_FORMAT_RGB565,
+        .dest_px_size = sizeof(uint16_t),
+        .opa = LV_OPA_MAX,
+        .use_mask = true,
+    };
+
+    ESP_LOGI(TAG_LV_IMAGE_FUNC, "running test for AL88 to RGB565 with mask");
+    lv_image_functionality(&test_case);
+}
+
+TEST_CASE("Test image functionality AL88 to RGB565 with mask and opacity", "[image][functionality][RGB565][mask_opa]")
+{
+    const image_test_case_params_t test_case = {
+        .blend_api_func = &lv_draw_sw_blend_image_to_rgb565,
+        .src_color_format = LV_COLOR_FORMAT_AL88,
+        .src_px_size = sizeof(uint16_t),
+        .dest_color_format = LV_COLOR_FORMAT_RGB565,
+        .dest_px_size = sizeof(uint16_t),
+        .opa = TEST_OPA,
+        .use_mask = true,
+    };
+
+    ESP_LOGI(TAG_LV_IMAGE_FUNC, "running test for AL88 to RGB565 with mask and opacity");
+    lv_image_functionality(&test_case);
+}
+
+// ------------------------------------------------ Static test functions ----------------------------------------------
+
+static void lv_image_functionality(const image_test_case_params_t *test_case)
+{
+    const size_t src_px = test_case->src_px_size;
+    const size_t dest_px = test_case->dest_px_size;
+    const size_t max_src_len = (MAX_W + MAX_STRIDE_PAD_PX) * MAX_H * src_px + MAX_UNALIGN_PX * src_px;
+    const size_t max_dest_len = (MAX_W + MAX_STRIDE_PAD_PX) * MAX_H * dest_px + MAX_UNALIGN_PX * dest_px + 2 * CANARY_BYTES;
+    const size_t max_mask_len = (MAX_W + MAX_STRIDE_PAD_PX) * MAX_H;
+    unsigned int test_combinations_count = 0;
+
+    // Allocate source, mask and destination buffers for Assembly and ANSI LVGL Blend API
+    uint8_t *src_buf = memalign(16, max_src_len);
+    uint8_t *dest_buf_asm = memalign(16, max_dest_len);
+    uint8_t *dest_buf_ansi = memalign(16, max_dest_len);
+    uint8_t *mask_buf = test_case->use_mask ? malloc(max_mask_len) : NULL;
+    TEST_ASSERT_NOT_NULL_MESSAGE(src_buf, "Lack of memory");
+    TEST_ASSERT_NOT_NULL_MESSAGE(dest_buf_asm, "Lack of memory");
+    TEST_ASSERT_NOT_NULL_MESSAGE(dest_buf_ansi, "Lack of memory");
+    TEST_ASSERT_MESSAGE(!test_case->use_mask || mask_buf, "Lack of memory");
+
+    for (int w = 1; w <= MAX_W; w++) {
+        for (int h = 1; h <= MAX_H; h++) {
+            for (int pad = 0; pad <= MAX_STRIDE_PAD_PX; pad++) {
+                for (int src_unalign = 0; src_unalign <= MAX_UNALIGN_PX; src_unalign++) {
+                    for (int dest_unalign = 0; dest_unalign <= MAX_UNALIGN_PX; dest_unalign++) {
+
+                        // Source and destination have different strides
+                        const int32_t src_stride = (w + pad) * src_px;
+                        const int32_t dest_stride = (w + MAX_STRIDE_PAD_PX - pad) * dest_px;
+
+                        fill_random(src_buf, max_src_len, test_case->src_color_format);
+                        fill_random(dest_buf_ansi, max_dest_len, test_case->dest_color_format);
+                        memcpy(dest_buf_asm, dest_buf_ansi, max_dest_len);
+                        if (mask_buf) {
+                            fill_random(mask_buf, max_mask_len, LV_COLOR_FORMAT_A8);
+                        }
+
+                        // Init structure for LVGL blend API, to call the Assembly API
+                        _lv_draw_sw_blend_image_dsc_t dsc_asm = {
+                            .dest_buf = dest_buf_asm + CANARY_BYTES + dest_unalign * dest_px,
+                            .dest_w = w,
+                            .dest_h = h,
+                            .dest_stride = dest_stride,
+                            .mask_buf = mask_buf,
+                            .mask_stride = w + pad,
+                            .src_buf = src_buf + src_unalign * src_px,
+                            .src_stride = src_stride,
+                            .src_color_format = test_case->src_color_format,
+                            .opa = test_case->opa,
+                            .blend_mode = LV_BLEND_MODE_NORMAL,
+                            .use_asm = true,
+                        };
+
+                        // Init structure for LVGL blend API, to call the ANSI API
+                        _lv_draw_sw_blend_image_dsc_t dsc_ansi = dsc_asm;
+                        dsc_ansi.dest_buf = dest_buf_ansi + CANARY_BYTES + dest_unalign * dest_px;
+                        dsc_ansi.use_asm = false;
+
+                        test_case->blend_api_func(&dsc_asm);    // Call the LVGL API with Assembly code
+                        test_case->blend_api_func(&dsc_ansi);   // Call the LVGL API with ANSI code
+
+                        // dest_buf_asm and dest_buf_ansi must be equal, including the canary bytes and the stride padding
+                        snprintf(test_msg_buf, sizeof(test_msg_buf), "Test case: w = %d, h = %d, pad = %d, src_unalign = %d, dest_unalign = %d, opa = %d, mask = %d",
+                                 w, h, pad, src_unalign, dest_unalign, test_case->opa, test_case->use_mask);
+                        TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE(dest_buf_ansi, dest_buf_asm, max_dest_len, test_msg_buf);
+                        test_combinations_count++;
+                    }
+                }
+            }
+        }
+    }
+    ESP_LOGI(TAG_LV_IMAGE_FUNC, "test combinations: %d\n", test_combinations_count);
+
+    free(src_buf);
+    free(dest_buf_asm);
+    free(dest_buf_ansi);
+    free(mask_buf);
+}
+
+static void fill_random(uint8_t *buf, size_t len, lv_color_format_t color_format)
+{
+    for (size_t i = 0; i < len; i++) {
+        buf[i] = (uint8_t)rand();
+    }
+
+    if (color_format == LV_COLOR_FORMAT_ARGB8888) {
+        for (size_t i = 3; i < len; i += 8) {
+            buf[i] = LV_OPA_COVER;
+        }
+        for (size_t i = 7; i < len; i += 24) {
+            buf[i] = LV_OPA_TRANSP;
+        }
+    } else if (color_format == LV_COLOR_FORMAT_AL88) {
+        for (size_t i = 1; i < len; i += 4) {
+            buf[i] = LV_OPA_COVER;
+        }
+        for (size_t i = 3; i < len; i += 12) {
+            buf[i] = LV_OPA_TRANSP;
+        }
+    } else if (color_format == LV_COLOR_FORMAT_A8) {
+        for (size_t i = 0; i < len; i++) {
+            if ((i % 4) == 0) {
+                buf[i] = LV_OPA_COVER;
+            } else if ((i % 5) == 0) {
+                buf[i] = LV_OPA_TRANSP;
+            }
+        }
+    }
+}
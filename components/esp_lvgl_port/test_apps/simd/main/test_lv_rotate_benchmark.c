@@ -0,0 +1,115 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <inttypes.h>
+#include <sdkconfig.h>
+
+#include "unity.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"  // for xthal_get_ccount()
+#include "esp_lvgl_port_rotate.h"
+
+#define WIDTH 320               // One draw buffer of 320x240 display (1/10 of the screen)
+#define HEIGHT 24
+#define BENCHMARK_CYCLES 20
+
+// ------------------------------------------------- Macros and Types --------------------------------------------------
+
+static const char *TAG_LV_ROTATE_BENCH = "LV Rotate Benchmark";
+static const char *kernel_naive_func[] = {"Kernel", "Naive"};
+
+// ------------------------------------------------ Static function headers --------------------------------------------
+
+/**
+ * @brief Run the benchmark test for RGB565 in memory with the selected capabilities
+ */
+static void lv_rotate_benchmark_rgb565(uint32_t caps, const char *mem_name);
+
+/**
+ * @brief Naive rotation (as in LVGL), walks the source row by row and the destination column by column
+ */
+static void rotate_rgb565_naive(const uint16_t *src, uint16_t *dst, int32_t w, int32_t h, int32_t src_stride, int32_t dst_stride, lvgl_port_rotate_t rotation);
+
+// ------------------------------------------------ Test cases ---------------------------------------------------------
+
+/*
+Benchmark tests
+
+Requires:
+    - To pass functionality tests first
+
+Purpose:
+    - Test that the tiled rotation kernel is faster than the naive rotation, mainly for the buffers in PSRAM
+
+Procedure:
+    - Allocate source and destination buffers of one draw buffer size in the internal RAM (and in PSRAM, if enabled)
+    - Rotate the buffer by 90° and 270° multiple times by the kernel and by the naive rotation, while counting CPU cycles
+    - Free test buffers
+*/
+
+TEST_CASE("LV Rotate benchmark RGB565", "[rotate][benchmark][RGB565]")
+{
+    lv_rotate_benchmark_rgb565(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT, "internal RAM");
+#if CONFIG_SPIRAM
+    lv_rotate_benchmark_rgb565(MALLOC_CAP_SPIRAM, "PSRAM");
+#endif
+}
+
+// ------------------------------------------------ Static test functions ----------------------------------------------
+
+static void lv_rotate_benchmark_rgb565(uint32_t caps, const char *mem_name)
+{
+    const size_t buf_len = WIDTH * HEIGHT * sizeof(uint16_t);
+    uint16_t *src = heap_caps_aligned_alloc(16, buf_len, caps);
+    uint16_t *dst = heap_caps_aligned_alloc(16, buf_len, caps);
+    TEST_ASSERT_NOT_NULL(src);
+    TEST_ASSERT_NOT_NULL(dst);
+
+    for (size_t i = 0; i < WIDTH * HEIGHT; i++) {
+        src[i] = (uint16_t)i;
+    }
+
+    ESP_LOGI(TAG_LV_ROTATE_BENCH, "running test for RGB565 color format in %s", mem_name);
+    const lvgl_port_rotate_t rotations[] = {LVGL_PORT_ROTATE_90, LVGL_PORT_ROTATE_270};
+    for (int r = 0; r < 2; r++) {
+        float cycles[2];
+        for (int i = 0; i < 2; i++) {
+            const unsigned int start_b = xthal_get_ccount();
+            for (int j = 0; j < BENCHMARK_CYCLES; j++) {
+                if (i == 0) {
+                    lvgl_port_rotate_rgb565(src, dst, WIDTH, HEIGHT, WIDTH * sizeof(uint16_t), HEIGHT * sizeof(uint16_t), rotations[r], false);
+                } else {
+                    rotate_rgb565_naive(src, dst, WIDTH, HEIGHT, WIDTH * sizeof(uint16_t), HEIGHT * sizeof(uint16_t), rotations[r]);
+                }
+            }
+            const unsigned int end_b = xthal_get_ccount();
+            cycles[i] = (float)(end_b - start_b) / BENCHMARK_CYCLES;
+            ESP_LOGI(TAG_LV_ROTATE_BENCH, " %s %s°: %.3f cycles for %dx%d matrix, %.3f cycles per sample", kernel_naive_func[i],
+                     (rotations[r] == LVGL_PORT_ROTATE_90 ? "90" : "270"), cycles[i], WIDTH, HEIGHT, cycles[i] / (WIDTH * HEIGHT));
+        }
+        TEST_ASSERT_LESS_THAN_FLOAT(cycles[1], cycles[0]);
+    }
+
+    heap_caps_free(src);
+    heap_caps_free(dst);
+}
+
+static void rotate_rgb565_naive(const uint16_t *src, uint16_t *dst, int32_t w, int32_t h, int32_t src_stride, int32_t dst_stride, lvgl_port_rotate_t rotation)
+{
+    src_stride /= sizeof(uint16_t);
+    dst_stride /= sizeof(uint16_t);
+    for (int32_t y = 0; y < h; y++) {
+        for (int32_t x = 0; x < w; x++) {
+            if (rotation == LVGL_PORT_ROTATE_90) {
+                dst[x * dst_stride + (h - 1 - y)] = src[y * src_stride + x];
+            } else {
+                dst[(w - 1 - x) * dst_stride + y] = src[y * src_stride + x];
+            }
+        }
+    }
+}
@@ -0,0 +1,308 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdlib.h>
+#include <malloc.h>
+#include <inttypes.h>
+#include "unity.h"
+#include "esp_log.h"
+#include "esp_lvgl_port_rotate.h"
+
+// ------------------------------------------------- Defines -----------------------------------------------------------
+
+#define CANARY_BYTES 4
+#define CANARY_VALUE 0xA5
+#define MAX_SIZE 37             // Maximal width and height of the tested image (more than 2 tiles, not multiple of 4)
+#define MAX_STRIDE_PAD 6        // Maximal padding at the end of the row in bytes
+
+// ------------------------------------------------- Macros and Types --------------------------------------------------
+
+typedef void (*rotate_func_t)(const void *src, void *dst, int32_t w, int32_t h, int32_t src_stride, int32_t dst_stride, lvgl_port_rotate_t rotation, bool swap);
+
+static const char *TAG_LV_ROTATE_FUNC = "LV Rotate Functionality";
+static const char *rotation_name[] = {"0", "90", "180", "270"};
+static char test_msg_buf[128];
+
+// ------------------------------------------------ Static function headers --------------------------------------------
+
+/**
+ * @brief Test all the combinations of width, height, stride, alignment and rotation for one pixel size
+ *
+ * @param[in] px_size Pixel size in bytes
+ * @param[in] func Rotation function to be tested
+ * @param[in] swap Swap bytes of the pixels (only RGB565)
+ */
+static void lv_rotate_functionality(int px_size, rotate_func_t func, bool swap);
+
+/**
+ * @brief Reference rotation, pixel by pixel
+ */
+static void rotate_reference(const uint8_t *src, uint8_t *dst, int32_t w, int32_t h, int32_t src_stride, int32_t dst_stride, lvgl_port_rotate_t rotation, int px_size, bool swap);
+
+/**
+ * @brief Reference rotation and packing into pages, pixel by pixel
+ */
+static void rotate_to_pages_reference(const uint8_t *src, uint8_t *dst, int32_t w, int32_t h, int32_t src_stride, int32_t dst_stride, lvgl_port_rotate_t rotation);
+
+static void rotate_rgb565(const void *src, void *dst, int32_t w, int32_t h, int32_t src_stride, int32_t dst_stride, lvgl_port_rotate_t rotation, bool swap)
+{
+    lvgl_port_rotate_rgb565(src, dst, w, h, src_stride, dst_stride, rotation, swap);
+}
+
+static void rotate_rgb888(const void *src, void *dst, int32_t w, int32_t h, int32_t src_stride, int32_t dst_stride, lvgl_port_rotate_t rotation, bool swap)
+{
+    (void)swap;
+    lvgl_port_rotate_rgb888(src, dst, w, h, src_stride, dst_stride, rotation);
+}
+
+static void rotate_argb8888(const void *src, void *dst, int32_t w, int32_t h, int32_t src_stride, int32_t dst_stride, lvgl_port_rotate_t rotation, bool swap)
+{
+    (void)swap;
+    lvgl_port_rotate_argb8888(src, dst, w, h, src_stride, dst_stride, rotation);
+}
+
+// ------------------------------------------------ Test cases ---------------------------------------------------------
+
+/*
+Functionality tests
+
+Purpose:
+    - Test that the tiled rotation kernels give the same results as a pixel by pixel rotation (with swapped bytes for RGB565)
+
+Procedure:
+    - Prepare random source image and go through all combinations of width, height, stride padding and buffer alignment
+    - Rotate the image by the reference function and by the kernel, for all 4 rotations
+    - Compare the destination images, check the canary bytes around the destination image
+*/
+
+TEST_CASE("Test rotate functionality RGB565", "[rotate][functionality][RGB565]")
+{
+    ESP_LOGI(TAG_LV_ROTATE_FUNC, "running test for RGB565 color format");
+    lv_rotate_functionality(2, rotate_rgb565, false);
+}
+
+TEST_CASE("Test rotate functionality RGB565 swap bytes", "[rotate][functionality][RGB565]")
+{
+    ESP_LOGI(TAG_LV_ROTATE_FUNC, "running test for RGB565 color format with swapped bytes");
+    lv_rotate_functionality(2, rotate_rgb565, true);
+}
+
+TEST_CASE("Test rotate functionality RGB888", "[rotate][functionality][RGB888]")
+{
+    ESP_LOGI(TAG_LV_ROTATE_FUNC, "running test for RGB888 color format");
+    lv_rotate_functionality(3, rotate_rgb888, false);
+}
+
+TEST_CASE("Test rotate functionality ARGB8888", "[rotate][functionality][ARGB8888]")
+{
+    ESP_LOGI(TAG_LV_ROTATE_FUNC, "running test for ARGB8888 color format");
+    lv_rotate_functionality(4, rotate_argb8888, false);
+}
+
+/*
+Functionality test of packing into pages of monochrome displays
+
+Purpose:
+    - Test that the packing gives the same results as a pixel by pixel rotation and packing
+
+Procedure:
+    - Prepare random source image and go through all combinations of width, height and stride padding, where the height
+      of the destination image is a multiple of 8
+    - Rotate and pack the image by the reference function and by the kernel, for all 4 rotations
+    - Compare the destination pages, check the canary bytes around the destination pages
+*/
+
+TEST_CASE("Test rotate functionality RGB565 to pages", "[rotate][functionality][RGB565]")
+{
+    const size_t buf_len = (MAX_SIZE * 2 + MAX_STRIDE_PAD) * MAX_SIZE + CANARY_BYTES * 2;
+    uint8_t *src_buf = memalign(16, buf_len);
+    uint8_t *ref_buf = memalign(16, buf_len);
+    uint8_t *dst_buf = memalign(16, buf_len);
+    TEST_ASSERT_NOT_NULL(src_buf);
+    TEST_ASSERT_NOT_NULL(ref_buf);
+    TEST_ASSERT_NOT_NULL(dst_buf);
+
+    for (size_t i = 0; i < buf_len; i++) {
+        src_buf[i] = (uint8_t)rand();
+    }
+
+    ESP_LOGI(TAG_LV_ROTATE_FUNC, "running test for RGB565 color format packed into pages");
+    uint32_t combinations = 0;
+    for (int32_t w = 1; w <= MAX_SIZE; w++) {
+        for (int32_t h = 1; h <= MAX_SIZE; h++) {
+            for (int32_t pad = 0; pad <= MAX_STRIDE_PAD; pad += 2) {
+                for (int rot = LVGL_PORT_ROTATE_0; rot <= LVGL_PORT_ROTATE_270; rot++) {
+                    const bool swap_xy = (rot == LVGL_PORT_ROTATE_90 || rot == LVGL_PORT_ROTATE_270);
+                    const int32_t dst_w = (swap_xy ? h : w);
+                    const int32_t dst_pages = (swap_xy ? w : h) / 8;
+                    if ((swap_xy ? w : h) % 8 != 0) {
+                        continue;
+                    }
+                    const int32_t src_stride = w * 2 + pad;
+                    const int32_t dst_stride = dst_w + pad;
+                    uint8_t *ref = ref_buf + CANARY_BYTES;
+                    uint8_t *dst = dst_buf + CANARY_BYTES;
+
+                    memset(ref_buf, CANARY_VALUE, buf_len);
+                    memset(dst_buf, CANARY_VALUE, buf_len);
+
+                    rotate_to_pages_reference(src_buf, ref, w, h, src_stride, dst_stride, rot);
+                    lvgl_port_rotate_rgb565_to_pages((const uint16_t *)src_buf, dst, w, h, src_stride, dst_stride, rot);
+
+                    snprintf(test_msg_buf, sizeof(test_msg_buf), "w: %"PRIi32", h: %"PRIi32", pad: %"PRIi32", rotation: %s",
+                             w, h, pad, rotation_name[rot]);
+                    for (int32_t page = 0; page < dst_pages; page++) {
+                        TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE(ref + page * dst_stride, dst + page * dst_stride, dst_w, test_msg_buf);
+                    }
+                    // Nothing written before and after the destination pages
+                    for (int i = 0; i < CANARY_BYTES; i++) {
+                        TEST_ASSERT_EQUAL_HEX8_MESSAGE(CANARY_VALUE, dst_buf[i], test_msg_buf);
+                    }
+                    const uint8_t *dst_end = dst + (dst_pages - 1) * dst_stride + dst_w;
+                    for (int i = 0; i < CANARY_BYTES; i++) {
+                        TEST_ASSERT_EQUAL_HEX8_MESSAGE(CANARY_VALUE, dst_end[i], test_msg_buf);
+                    }
+                    combinations++;
+                }
+            }
+        }
+    }
+    ESP_LOGI(TAG_LV_ROTATE_FUNC, "test combinations: %"PRIu32, combinations);
+
+    free(src_buf);
+    free(ref_buf);
+    free(dst_buf);
+}
+
+// ------------------------------------------------ Static test functions ----------------------------------------------
+
+static void lv_rotate_functionality(int px_size, rotate_func_t func, bool swap)
+{
+    const size_t buf_len = (MAX_SIZE * px_size + MAX_STRIDE_PAD) * MAX_SIZE + 4 + CANARY_BYTES * 2;
+    uint8_t *src_buf = memalign(16, buf_len);
+    uint8_t *ref_buf = memalign(16, buf_len);
+    uint8_t *dst_buf = memalign(16, buf_len);
+    TEST_ASSERT_NOT_NULL(src_buf);
+    TEST_ASSERT_NOT_NULL(ref_buf);
+    TEST_ASSERT_NOT_NULL(dst_buf);
+
+    for (size_t i = 0; i < buf_len; i++) {
+        src_buf[i] = (uint8_t)rand();
+    }
+
+    uint32_t combinations = 0;
+    for (int32_t w = 1; w <= MAX_SIZE; w++) {
+        for (int32_t h = 1; h <= MAX_SIZE; h++) {
+            for (int32_t pad = 0; pad <= MAX_STRIDE_PAD; pad += 2) {
+                // Unaligned buffers only with the 4-byte aligned stride, the other cases are unaligned anyway
+                for (int32_t unalign = 0; unalign < (pad % 4 == 0 ? 4 : 1); unalign++) {
+                    for (int rot = LVGL_PORT_ROTATE_0; rot <= LVGL_PORT_ROTATE_270; rot++) {
+                        const bool swap_xy = (rot == LVGL_PORT_ROTATE_90 || rot == LVGL_PORT_ROTATE_270);
+                        const int32_t src_stride = w * px_size + pad;
+                        const int32_t dst_w = (swap_xy ? h : w);
+                        const int32_t dst_h = (swap_xy ? w : h);
+                        const int32_t dst_stride = dst_w * px_size + pad;
+                        uint8_t *src = src_buf + unalign;
+                        uint8_t *ref = ref_buf + CANARY_BYTES + unalign;
+                        uint8_t *dst = dst_buf + CANARY_BYTES + unalign;
+
+                        memset(ref_buf, CANARY_VALUE, buf_len);
+                        memset(dst_buf, CANARY_VALUE, buf_len);
+
+                        rotate_reference(src, ref, w, h, src_stride, dst_stride, rot, px_size, swap);
+                        func(src, dst, w, h, src_stride, dst_stride, rot, swap);
+
+                        snprintf(test_msg_buf, sizeof(test_msg_buf), "w: %"PRIi32", h: %"PRIi32", pad: %"PRIi32", unalign: %"PRIi32", rotation: %s",
+                                 w, h, pad, unalign, rotation_name[rot]);
+                        for (int32_t y = 0; y < dst_h; y++) {
+                            TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE(ref + y * dst_stride, dst + y * dst_stride, dst_w * px_size, test_msg_buf);
+                        }
+                        // Nothing written before and after the destination image
+                        for (int i = 0; i < CANARY_BYTES + unalign; i++) {
+                            TEST_ASSERT_EQUAL_HEX8_MESSAGE(CANARY_VALUE, dst_buf[i], test_msg_buf);
+                        }
+                        const uint8_t *dst_end = dst + (dst_h - 1) * dst_stride + dst_w * px_size;
+                        for (int i = 0; i < CANARY_BYTES; i++) {
+                            TEST_ASSERT_EQUAL_HEX8_MESSAGE(CANARY_VALUE, dst_end[i], test_msg_buf);
+                        }
+                        combinations++;
+                    }
+                }
+            }
+        }
+    }
+    ESP_LOGI(TAG_LV_ROTATE_FUNC, "test combinations: %"PRIu32, combinations);
+
+    free(src_buf);
+    free(ref_buf);
+    free(dst_buf);
+}
+
+static void rotate_reference(const uint8_t *src, uint8_t *dst, int32_t w, int32_t h, int32_t src_stride, int32_t dst_stride, lvgl_port_rotate_t rotation, int px_size, bool swap)
+{
+    for (int32_t y = 0; y < h; y++) {
+        for (int32_t x = 0; x < w; x++) {
+            int32_t dst_x = x;
+            int32_t dst_y = y;
+            switch (rotation) {
+            case LVGL_PORT_ROTATE_90:
+                dst_x = h - 1 - y;
+                dst_y = x;
+                break;
+            case LVGL_PORT_ROTATE_180:
+                dst_x = w - 1 - x;
+                dst_y = h - 1 - y;
+                break;
+            case LVGL_PORT_ROTATE_270:
+                dst_x = y;
+                dst_y = w - 1 - x;
+                break;
+            default:
+                break;
+            }
+            uint8_t *d = dst + dst_y * dst_stride + dst_x * px_size;
+            const uint8_t *s = src + y * src_stride + x * px_size;
+            for (int i = 0; i < px_size; i++) {
+                d[i] = (swap ? s[px_size - 1 - i] : s[i]);
+            }
+        }
+    }
+}
+
+static void rotate_to_pages_reference(const uint8_t *src, uint8_t *dst, int32_t w, int32_t h, int32_t src_stride, int32_t dst_stride, lvgl_port_rotate_t rotation)
+{
+    for (int32_t y = 0; y < h; y++) {
+        for (int32_t x = 0; x < w; x++) {
+            int32_t dst_x = x;
+            int32_t dst_y = y;
+            switch (rotation) {
+            case LVGL_PORT_ROTATE_90:
+                dst_x = h - 1 - y;
+                dst_y = x;
+                break;
+            case LVGL_PORT_ROTATE_180:
+                dst_x = w - 1 - x;
+                dst_y = h - 1 - y;
+                break;
+            case LVGL_PORT_ROTATE_270:
+                dst_x = y;
+                dst_y = w - 1 - x;
+                break;
+            default:
+                break;
+            }
+            // Dark pixel (no color channel with the MSB set) is 1, the LSB of the byte is the top pixel of the page
+            uint16_t px;
+            memcpy(&px, src + y * src_stride + x * 2, sizeof(px));
+            const uint8_t bit = 1 << (dst_y % 8);
+            uint8_t *d = dst + (dst_y / 8) * dst_stride + dst_x;
+            *d = ((px & 0x8410) == 0 ? (*d | bit) : (*d & ~bit));
+        }
+    }
+}
@@ -0,0 +1,226 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <malloc.h>
+#include <inttypes.h>
+#include <sdkconfig.h>
+
+#include "unity.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"  // for xthal_get_ccount()
+#include "lv_draw_sw_blend.h"
+#include "lv_draw_sw_blend_to_rgb565.h"
+
+#define TEXT_W 320              // Width of the destination buffer in pixels
+#define TEXT_LINES 10           // Lines of text rendered in one benchmark run
+#define GLYPH_CNT 16            // Count of the different glyphs of the font
+#define BENCHMARK_CYCLES 100
+
+// ------------------------------------------------- Macros and Types --------------------------------------------------
+
+/**
+ * @brief Synthetic A8 font, glyphs are generated with a typical coverage of the text glyphs
+ */
+typedef struct {
+    const char *name;           // Name of the font, for the log
+    int32_t glyph_w;            // Width of the glyph bitmap in pixels
+    int32_t glyph_h;            // Height of the glyph bitmap in pixels
+    int32_t letter_space;       // Space between the glyphs in pixels
+    int32_t line_space;         // Space between the lines in pixels
+} text_font_params_t;
+
+static const char *TAG_LV_TEXT_BENCH = "LV Text Benchmark";
+static const char *asm_ansi_func[] = {"ASM", "ANSI"};
+static lv_color_t test_text_color = {
+    .blue = 0x20,
+    .green = 0xE0,
+    .red = 0xF0,
+};
+
+// ------------------------------------------------ Static function headers --------------------------------------------
+
+/**
+ * @brief Initialize and run the text rendering benchmark
+ *
+ * @param[in] font Parameters of the synthetic font
+ */
+static void lv_text_benchmark_init(const text_font_params_t *font);
+
+/**
+ * @brief Render TEXT_LINES lines of text, glyph by glyph, as LVGL does with A8 glyph bitmaps
+ */
+static void lv_text_render(const text_font_params_t *font, uint8_t *const *glyphs, uint16_t *dest_buf, bool use_asm);
+
+/**
+ * @brief Generate an anti-aliased glyph bitmap
+ *
+ * Glyph consists of a random set of 2 pixels wide vertical and horizontal strokes with anti-aliased edges
+ */
+static void generate_glyph(uint8_t *glyph, int32_t w, int32_t h);
+
+/**
+ * @brief Add an anti-aliased edge pixel to the glyph, a pixel of another stroke is kept
+ */
+static void add_glyph_edge(uint8_t *px);
+
+// ------------------------------------------------ Test cases ---------------------------------------------------------
+
+/*
+Text rendering benchmark
+
+Requires:
+    - To pass fill functionality tests first
+
+Purpose:
+    - Measure an acceleration of the text rendering, achieved by the assembly implementation of the fill with mask
+
+Procedure:
+    - Generate a synthetic A8 font (glyphs with fully transparent, fully covered and anti-aliased pixels)
+    - Render TEXT_LINES lines of text into an RGB565 buffer, each glyph is a color fill with the glyph bitmap as a mask
+    - Count how many CPU cycles does it take to render the text, using the assembly and the ANSI fill
+    - Free test arrays
+*/
+
+TEST_CASE("LV Text benchmark RGB565 small font", "[text][benchmark][RGB565]")
+{
+    const text_font_params_t font = {
+        .name = "small font (8x14)",
+        .glyph_w = 8,
+        .glyph_h = 14,
+        .letter_space = 1,
+        .line_space = 4,
+    };
+
+    ESP_LOGI(TAG_LV_TEXT_BENCH, "running test for RGB565, %s", font.name);
+    lv_text_benchmark_init(&font);
+}
+
+TEST_CASE("LV Text benchmark RGB565 large font", "[text][benchmark][RGB565]")
+{
+    const text_font_params_t font = {
+        .name = "large font (18x28)",
+        .glyph_w = 18,
+        .glyph_h = 28,
+        .letter_space = 2,
+        .line_space = 6,
+    };
+
+    ESP_LOGI(TAG_LV_TEXT_BENCH, "running test for RGB565, %s", font.name);
+    lv_text_benchmark_init(&font);
+}
+
+// ------------------------------------------------ Static test functions ----------------------------------------------
+
+static void lv_text_benchmark_init(const text_font_params_t *font)
+{
+    const int32_t line_h = font->glyph_h + font->line_space;
+    const size_t dest_len = TEXT_W * line_h * TEXT_LINES;
+    const int32_t glyphs_per_line = TEXT_W / (font->glyph_w + font->letter_space);
+
+    uint16_t *dest_buf = (uint16_t *)memalign(16, dest_len * sizeof(uint16_t));
+    TEST_ASSERT_NOT_NULL(dest_buf);
+
+    uint8_t *glyphs[GLYPH_CNT];
+    for (int i = 0; i < GLYPH_CNT; i++) {
+        glyphs[i] = (uint8_t *)malloc(font->glyph_w * font->glyph_h);
+        TEST_ASSERT_NOT_NULL(glyphs[i]);
+        generate_glyph(glyphs[i], font->glyph_w, font->glyph_h);
+    }
+
+    // Run benchmark 2 times:
+    // First run using assembly, second run using ANSI
+    for (int i = 0; i < 2; i++) {
+        const bool use_asm = (i == 0);
+
+        // Dark background
+        for (size_t j = 0; j < dest_len; j++) {
+            dest_buf[j] = 0x0841;
+        }
+
+        // Call the DUT function for the first time to init the benchmark test
+        lv_text_render(font, glyphs, dest_buf, use_asm);
+
+        const unsigned int start_b = xthal_get_ccount();
+        for (int j = 0; j < BENCHMARK_CYCLES; j++) {
+            lv_text_render(font, glyphs, dest_buf, use_asm);
+        }
+        const unsigned int end_b = xthal_get_ccount();
+
+        const float cycles = (float)(end_b - start_b) / BENCHMARK_CYCLES;
+        ESP_LOGI(TAG_LV_TEXT_BENCH, " %s: %.3f cycles for %d lines, %.3f cycles per line, %.3f cycles per glyph", asm_ansi_func[i], cycles, TEXT_LINES,
+                 cycles / TEXT_LINES, cycles / (TEXT_LINES * glyphs_per_line));
+    }
+
+    for (int i = 0; i < GLYPH_CNT; i++) {
+        free(glyphs[i]);
+    }
+    free(dest_buf);
+}
+
+static void lv_text_render(const text_font_params_t *font, uint8_t *const *glyphs, uint16_t *dest_buf, bool use_asm)
+{
+    const int32_t line_h = font->glyph_h + font->line_space;
+    const int32_t advance = font->glyph_w + font->letter_space;
+
+    _lv_draw_sw_blend_fill_dsc_t dsc = {
+        .dest_w = font->glyph_w,
+        .dest_h = font->glyph_h,
+        .dest_stride = TEXT_W * sizeof(uint16_t),
+        .mask_stride = font->glyph_w,
+        .color = test_text_color,
+        .opa = LV_OPA_COVER,
+        .use_asm = use_asm,
+    };
+
+    int glyph_idx = 0;
+    for (int32_t line = 0; line < TEXT_LINES; line++) {
+        uint16_t *line_buf = dest_buf + line * line_h * TEXT_W;
+        for (int32_t x = 0; x + font->glyph_w <= TEXT_W; x += advance) {
+            dsc.dest_buf = line_buf + x;
+            dsc.mask_buf = glyphs[glyph_idx];
+            lv_draw_sw_blend_color_to_rgb565(&dsc);
+            glyph_idx = (glyph_idx + 1) % GLYPH_CNT;
+        }
+    }
+}
+
+static void generate_glyph(uint8_t *glyph, int32_t w, int32_t h)
+{
+    memset(glyph, LV_OPA_TRANSP, w * h);
+
+    // 1 or 2 vertical strokes and 1 to 3 horizontal strokes
+    const int v_strokes = 1 + rand() % 2;
+    const int h_strokes = 1 + rand() % 3;
+
+    for (int s = 0; s < v_strokes; s++) {
+        const int32_t sx = 1 + rand() % (w - 3);
+        for (int32_t y = 0; y < h; y++) {
+            uint8_t *row = &glyph[y * w];
+            row[sx] = LV_OPA_COVER;
+            row[sx + 1] = LV_OPA_COVER;
+            add_glyph_edge(&row[sx - 1]);
+            add_glyph_edge(&row[sx + 2]);
+        }
+    }
+
+    for (int s = 0; s < h_strokes; s++) {
+        const int32_t sy = 1 + rand() % (h - 3);
+        for (int32_t x = 0; x < w; x++) {
+            glyph[sy * w + x] = LV_OPA_COVER;
+            glyph[(sy + 1) * w + x] = LV_OPA_COVER;
+            add_glyph_edge(&glyph[(sy - 1) * w + x]);
+            add_glyph_edge(&glyph[(sy + 2) * w + x]);
+        }
+    }
+}
+
+static void add_glyph_edge(uint8_t *px)
+{
+    const uint8_t edge = 1 + rand() % 254;     // LV_OPA_TRANSP < edge < LV_OPA_COVER
+    *px = LV_MAX(*px, edge);
+}
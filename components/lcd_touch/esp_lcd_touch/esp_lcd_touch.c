@@ -1,10 +1,12 @@
 /*
- * SPDX-FileCopyrightText: 2015-2023 Espressif Systems (Shanghai) CO LTD
+ * SPDX-FileCopyrightText: 2015-2024 Espressif Systems (Shanghai) CO LTD
  *
  * SPDX-License-Identifier: Apache-2.0
  */
 
 #include <stdlib.h>
+#include <string.h>
+#include <sys/param.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "driver/gpio.h"
@@ -12,13 +14,24 @@
 #include "esp_err.h"
 #include "esp_check.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 #include "esp_lcd_touch.h"
 
 static const char *TAG = "TP";
 
+/* Filter: positions are in 1/16 px, speeds in 1/4096 px per ms and smoothing factors in 1/32768 */
+#define FILTER_POS_SHIFT        (4)
+#define FILTER_SPEED_SHIFT      (12)
+#define FILTER_ALPHA_SHIFT      (15)
+#define FILTER_MAX_DT_US        (65535)     /* Longer time between the samples is clamped */
+#define FILTER_MAX_SPEED        (1 << 22)   /* 1024 px per ms */
+#define FILTER_D_CUTOFF_MHZ     (1000)      /* Cutoff frequency of the speed smoother (as the 1-euro filter) */
+#define FILTER_TAU_US_MHZ       (159154943) /* Time constant of 1 mHz cutoff frequency: 1 / (2 * pi * 1 mHz) in us */
+
 /*******************************************************************************
 * Function definitions
 *******************************************************************************/
+static void touch_filter_apply(esp_lcd_touch_handle_t tp, esp_lcd_touch_sample_t *sample);
 
 /*******************************************************************************
 * Local variables
@@ -58,6 +71,89 @@ esp_err_t esp_lcd_touch_read_data(esp_lcd_touch_handle_t tp)
     return tp->read_data(tp);
 }
 
+esp_err_t esp_lcd_touch_peek_sample(esp_lcd_touch_handle_t tp, esp_lcd_touch_sample_t *sample)
+{
+    uint32_t lock;
+
+    assert(tp != NULL);
+    assert(sample != NULL);
+
+    /*
+     * The driver writes the other sample than the last published one (also while the lock is odd). The copied sample
+     * is overwritten only by the next but one sample, so the copy is repeated, when the driver started writing it
+     * meanwhile (the lock moved more than 2 steps from the even lock of the copied sample).
+     * Nothing published yet: the copied sample is zeroed (seq is 0).
+     */
+    do {
+        lock = __atomic_load_n(&tp->data.seq, __ATOMIC_ACQUIRE) & ~1UL;
+        *sample = tp->data.sample[(lock / 2) & 1];
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    } while (__atomic_load_n(&tp->data.seq, __ATOMIC_RELAXED) - lock > 2);
+
+    return ESP_OK;
+}
+
+void esp_lcd_touch_publish_sample(esp_lcd_touch_handle_t tp, const esp_lcd_touch_sample_t *sample)
+{
+    assert(tp != NULL);
+    assert(sample != NULL);
+
+    /* Only the driver changes the sequence lock, the new sample is written into the not published one */
+    const uint32_t lock = tp->data.seq;
+    const uint32_t last_seq = tp->data.sample[(lock / 2) & 1].seq;
+    esp_lcd_touch_sample_t *dst = &tp->data.sample[(lock / 2 + 1) & 1];
+
+    /* Odd lock: readers of the overwritten sample repeat the copy, the data must not be stored before the lock */
+    __atomic_store_n(&tp->data.seq, lock + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    /* Sequence number 0 means nothing published, it is skipped on wrap around */
+    dst->seq = (last_seq + 1 != 0 ? last_seq + 1 : 1);
+    dst->timestamp_us = (sample->timestamp_us ? sample->timestamp_us : esp_timer_get_time());
+    dst->points = (sample->points > CONFIG_ESP_LCD_TOUCH_MAX_POINTS ? CONFIG_ESP_LCD_TOUCH_MAX_POINTS : sample->points);
+    memcpy(dst->coords, sample->coords, dst->points * sizeof(dst->coords[0]));
+
+    /* Filter the points (only the driver task runs the filter) */
+    touch_filter_apply(tp, dst);
+
+    /* Publish the sample, after it is complete */
+    __atomic_store_n(&tp->data.seq, lock + 2, __ATOMIC_RELEASE);
+}
+
+bool esp_lcd_touch_get_sample_xy(esp_lcd_touch_handle_t tp, uint16_t *x, uint16_t *y, uint16_t *strength, uint8_t *point_num, uint8_t max_point_num)
+{
+    esp_lcd_touch_sample_t sample;
+
+    assert(tp != NULL);
+    assert(x != NULL);
+    assert(y != NULL);
+    assert(point_num != NULL);
+    assert(max_point_num > 0);
+
+    esp_lcd_touch_peek_sample(tp, &sample);
+
+    /* Each sample is returned only once (it was invalidated by get_xy of the drivers before) */
+    if (sample.seq == tp->data.consumed_seq) {
+        *point_num = 0;
+        return false;
+    }
+    tp->data.consumed_seq = sample.seq;
+
+    /* Count of points */
+    *point_num = (sample.points > max_point_num ? max_point_num : sample.points);
+
+    for (size_t i = 0; i < *point_num; i++) {
+        x[i] = sample.coords[i].x;
+        y[i] = sample.coords[i].y;
+
+        if (strength) {
+            strength[i] = sample.coords[i].strength;
+        }
+    }
+
+    return (*point_num > 0);
+}
+
 bool esp_lcd_touch_get_coordinates(esp_lcd_touch_handle_t tp, uint16_t *x, uint16_t *y, uint16_t *strength, uint8_t *point_num, uint8_t max_point_num)
 {
     bool touched = false;
@@ -106,6 +202,22 @@ bool esp_lcd_touch_get_coordinates(esp_lcd_touch_handle_t tp, uint16_t *x, uint1
     return touched;
 }
 
+esp_err_t esp_lcd_touch_set_filter(esp_lcd_touch_handle_t tp, const esp_lcd_touch_filter_config_t *config)
+{
+    assert(tp != NULL);
+
+    if (config) {
+        tp->config.filter = *config;
+    } else {
+        memset(&tp->config.filter, 0, sizeof(tp->config.filter));
+    }
+
+    /* Start tracking from scratch */
+    memset(tp->data.filter, 0, sizeof(tp->data.filter));
+
+    return ESP_OK;
+}
+
 #if (CONFIG_ESP_LCD_TOUCH_MAX_BUTTONS > 0)
 esp_err_t esp_lcd_touch_get_button_state(esp_lcd_touch_handle_t tp, uint8_t n, uint8_t *state)
 {
@@ -264,3 +376,152 @@ esp_err_t esp_lcd_touch_register_interrupt_callback_with_data(esp_lcd_touch_hand
     tp->config.user_data = user_data;
     return esp_lcd_touch_register_interrupt_callback(tp, callback);
 }
+
+/*******************************************************************************
+* Private API function
+*******************************************************************************/
+
+/* Smoothing factor of the first order low-pass filter: alpha = dt / (dt + tau) */
+static uint32_t touch_filter_alpha(uint32_t cutoff_mhz, uint32_t dt_us)
+{
+    const uint32_t tau_us = FILTER_TAU_US_MHZ / cutoff_mhz;
+    return (dt_us << FILTER_ALPHA_SHIFT) / (dt_us + tau_us);
+}
+
+static int32_t touch_filter_lowpass(int32_t prev, int32_t in, uint32_t alpha)
+{
+    return prev + (int32_t)((((int64_t)in - prev) * alpha + (1 << (FILTER_ALPHA_SHIFT - 1))) >> FILTER_ALPHA_SHIFT);
+}
+
+/* Speed in 1/4096 px per ms from the position change in 1/16 px */
+static int32_t touch_filter_speed(int32_t diff, uint32_t dt_us)
+{
+    const int64_t speed = ((int64_t)diff * (1000 << (FILTER_SPEED_SHIFT - FILTER_POS_SHIFT))) / dt_us;
+    return MAX(-FILTER_MAX_SPEED, MIN(FILTER_MAX_SPEED, speed));
+}
+
+/* Position follows the input only when it moves out of the deadband around the anchor */
+static uint16_t touch_filter_deadband(uint16_t anchor, uint16_t in, uint16_t deadband)
+{
+    if (in > anchor + deadband) {
+        return in - deadband;
+    } else if (in + deadband < anchor) {
+        return in + deadband;
+    }
+    return anchor;
+}
+
+static uint16_t touch_filter_output(int32_t pos, uint16_t max)
+{
+    pos = (pos + (1 << (FILTER_POS_SHIFT - 1))) >> FILTER_POS_SHIFT;
+    if (max == 0) {
+        max = UINT16_MAX;
+    }
+    return (pos < 0 ? 0 : MIN(pos, max));
+}
+
+static void touch_filter_point(const esp_lcd_touch_filter_config_t *cfg, esp_lcd_touch_filter_point_t *f, uint16_t *x, uint16_t *y,
+                               int64_t timestamp_us, uint16_t x_max, uint16_t y_max)
+{
+    if (!f->active) {
+        /* New touch point, nothing to filter yet */
+        f->active = true;
+        f->anchor_x = *x;
+        f->anchor_y = *y;
+        f->x = (int32_t)*x << FILTER_POS_SHIFT;
+        f->y = (int32_t)*y << FILTER_POS_SHIFT;
+        f->vx = 0;
+        f->vy = 0;
+        f->timestamp_us = timestamp_us;
+        return;
+    }
+
+    const uint32_t dt_us = MAX(1, MIN(FILTER_MAX_DT_US, timestamp_us - f->timestamp_us));
+    f->timestamp_us = timestamp_us;
+
+    /* Deadband */
+    f->anchor_x = touch_filter_deadband(f->anchor_x, *x, cfg->deadband);
+    f->anchor_y = touch_filter_deadband(f->anchor_y, *y, cfg->deadband);
+    const int32_t in_x = (int32_t)f->anchor_x << FILTER_POS_SHIFT;
+    const int32_t in_y = (int32_t)f->anchor_y << FILTER_POS_SHIFT;
+
+    /* Speed is smoothed with fixed cutoff frequency */
+    const uint32_t alpha_d = touch_filter_alpha(FILTER_D_CUTOFF_MHZ, dt_us);
+    f->vx = touch_filter_lowpass(f->vx, touch_filter_speed(in_x - f->x, dt_us), alpha_d);
+    f->vy = touch_filter_lowpass(f->vy, touch_filter_speed(in_y - f->y, dt_us), alpha_d);
+
+    /* Smoother (1-euro filter), the cutoff frequency grows with the speed: less jitter of slow touch, less lag of fast one */
+    if (cfg->min_cutoff_mhz) {
+        const uint32_t speed = ((uint64_t)MAX(abs(f->vx), abs(f->vy)) * 1000) >> FILTER_SPEED_SHIFT;
+        const uint64_t cutoff_mhz = MIN(FILTER_TAU_US_MHZ, cfg->min_cutoff_mhz + (uint64_t)cfg->beta * speed);
+        const uint32_t alpha = touch_filter_alpha(cutoff_mhz, dt_us);
+        f->x = touch_filter_lowpass(f->x, in_x, alpha);
+        f->y = touch_filter_lowpass(f->y, in_y, alpha);
+    } else {
+        f->x = in_x;
+        f->y = in_y;
+    }
+
+    /* Linear prediction */
+    const int32_t shift = FILTER_SPEED_SHIFT - FILTER_POS_SHIFT;
+    *x = touch_filter_output(f->x + (int32_t)(((int64_t)f->vx * cfg->predict_ms) >> shift), x_max);
+    *y = touch_filter_output(f->y + (int32_t)(((int64_t)f->vy * cfg->predict_ms) >> shift), y_max);
+}
+
+static void touch_filter_apply(esp_lcd_touch_handle_t tp, esp_lcd_touch_sample_t *sample)
+{
+    const esp_lcd_touch_filter_config_t *cfg = &tp->config.filter;
+    esp_lcd_touch_filter_point_t *filter = tp->data.filter;
+    int track[CONFIG_ESP_LCD_TOUCH_MAX_POINTS];
+    bool used[CONFIG_ESP_LCD_TOUCH_MAX_POINTS] = {0};
+
+    if (cfg->deadband == 0 && cfg->min_cutoff_mhz == 0 && cfg->predict_ms == 0) {
+        return;
+    }
+
+    /* Tracked touch points are paired with the nearest points of the sample, closest pairs first (controllers can reorder the points) */
+    for (int p = 0; p < sample->points; p++) {
+        track[p] = -1;
+    }
+    while (true) {
+        uint32_t best_dist = UINT32_MAX;
+        int best_p = -1;
+        int best_f = -1;
+        for (int p = 0; p < sample->points; p++) {
+            for (int f = 0; (track[p] < 0 && f < CONFIG_ESP_LCD_TOUCH_MAX_POINTS); f++) {
+                if (!filter[f].active || used[f]) {
+                    continue;
+                }
+                const uint32_t dist = abs(sample->coords[p].x - filter[f].anchor_x) + abs(sample->coords[p].y - filter[f].anchor_y);
+                if (dist < best_dist) {
+                    best_dist = dist;
+                    best_p = p;
+                    best_f = f;
+                }
+            }
+        }
+        if (best_p < 0) {
+            break;
+        }
+        track[best_p] = best_f;
+        used[best_f] = true;
+    }
+
+    /* Released touch points are not tracked anymore */
+    for (int f = 0; f < CONFIG_ESP_LCD_TOUCH_MAX_POINTS; f++) {
+        filter[f].active = used[f];
+    }
+
+    for (int p = 0; p < sample->points; p++) {
+        /* New touch point */
+        for (int f = 0; (track[p] < 0 && f < CONFIG_ESP_LCD_TOUCH_MAX_POINTS); f++) {
+            if (!used[f]) {
+                track[p] = f;
+                used[f] = true;
+            }
+        }
+
+        touch_filter_point(cfg, &filter[track[p]], &sample->coords[p].x, &sample->coords[p].y, sample->timestamp_us,
+                           tp->config.x_max, tp->config.y_max);
+    }
+}
@@ -36,6 +36,24 @@ typedef esp_lcd_touch_t *esp_lcd_touch_handle_t;
  */
 typedef void (*esp_lcd_touch_interrupt_callback_t)(esp_lcd_touch_handle_t tp);
 
+/**
+ * @brief Touch filter configuration
+ *
+ * Integer-only filter stage, applied to every sample published by esp_lcd_touch_publish_sample (in the task reading
+ * the touch). Each touch point is tracked and filtered separately. All zeros = filter disabled.
+ *
+ * @note Track IDs of the controllers are not available in this API, the points are paired with the tracked points
+ *       of the previous sample by the nearest distance instead. When two fingers cross or come closer than they move
+ *       between two samples, the points can be swapped and the filter state (position, speed) of the two fingers mixed.
+ *       The filtered points then jump or lag for a few samples.
+ */
+typedef struct {
+    uint16_t deadband;          /*!< Jitter deadband in pixels, the position follows the touch only when it moves out of it (0 = disabled) */
+    uint16_t min_cutoff_mhz;    /*!< Smoother (1-euro filter) minimum cutoff frequency in mHz, lower = less jitter of a slow touch (0 = smoother disabled) */
+    uint16_t beta;              /*!< Increase of the smoother cutoff frequency in mHz per px/s of speed, higher = less lag of a fast touch (0 = IIR low-pass) */
+    uint16_t predict_ms;        /*!< Linear prediction of the position N ms ahead from the touch speed, compensates the latency (0 = disabled) */
+} esp_lcd_touch_filter_config_t;
+
 /**
  * @brief Touch Configuration Type
  *
@@ -66,10 +84,47 @@ typedef struct {
     void *user_data;
     /*!< User data passed to driver */
     void *driver_data;
+    /*!< Filter of the touch points (deadband, smoother and prediction) */
+    esp_lcd_touch_filter_config_t filter;
 } esp_lcd_touch_config_t;
 
+/* Drivers publish samples, esp_lcd_touch_peek_sample() is available */
+#define ESP_LCD_TOUCH_PUBLISHED_SAMPLES  1
+
+/**
+ * @brief Touch sample published by the driver
+ *
+ * Coordinates are in the controller orientation (before SW mirroring, swapping and process_coordinates callback),
+ * they are filtered, when the filter is configured.
+ */
+typedef struct {
+    uint32_t seq;           /*!< Sequence number of the sample, it is incremented by every published sample (0 = nothing published yet) */
+    int64_t timestamp_us;   /*!< Time of the sample (esp_timer_get_time()), the publication time if the driver did not set it */
+    uint8_t points;         /*!< Count of touch points */
+
+    struct {
+        uint16_t x; /*!< X coordinate */
+        uint16_t y; /*!< Y coordinate */
+        uint16_t strength; /*!< Strength */
+    } coords[CONFIG_ESP_LCD_TOUCH_MAX_POINTS];
+} esp_lcd_touch_sample_t;
+
+/**
+ * @brief State of the filter of one tracked touch point
+ */
+typedef struct {
+    bool active;            /*!< Touch point is tracked */
+    uint16_t anchor_x;      /*!< Deadband anchor X */
+    uint16_t anchor_y;      /*!< Deadband anchor Y */
+    int32_t x;              /*!< Smoothed X (1/16 px) */
+    int32_t y;              /*!< Smoothed Y (1/16 px) */
+    int32_t vx;             /*!< Smoothed speed X (1/4096 px per ms) */
+    int32_t vy;             /*!< Smoothed speed Y (1/4096 px per ms) */
+    int64_t timestamp_us;   /*!< Time of the last sample */
+} esp_lcd_touch_filter_point_t;
+
 typedef struct {
-    uint8_t points; /*!< Count of touch points saved */
+    uint8_t points; /*!< Count of touch points saved (only drivers without esp_lcd_touch_publish_sample) */
 
     struct {
         uint16_t x; /*!< X coordinate */
@@ -86,6 +141,13 @@ typedef struct {
 #endif
 
     portMUX_TYPE lock; /*!< Lock for read/write */
+
+    /* Published samples, the writer fills the inactive one and publishes it by the sequence lock, readers don't lock */
+    esp_lcd_touch_sample_t sample[2];   /*!< Published samples, sample[(seq / 2) & 1] is the last one */
+    volatile uint32_t seq;              /*!< Sequence lock, incremented by 2 by every published sample (odd, while the next one is written) */
+    uint32_t consumed_seq;              /*!< Sequence number of the last sample returned by esp_lcd_touch_get_sample_xy */
+
+    esp_lcd_touch_filter_point_t filter[CONFIG_ESP_LCD_TOUCH_MAX_POINTS]; /*!< Filter state of the tracked touch points */
 } esp_lcd_touch_data_t;
 
 /**
@@ -271,6 +333,48 @@ struct esp_lcd_touch_s {
  */
 esp_err_t esp_lcd_touch_read_data(esp_lcd_touch_handle_t tp);
 
+/**
+ * @brief Get the last sample published by the touch driver, without consuming it
+ *
+ * @note The sample is read without any lock, it is never torn. It can be called from any task or ISR.
+ * @note It is supported by the drivers, which use esp_lcd_touch_publish_sample.
+ *
+ * @param tp: Touch handler
+ * @param sample: Copy of the last published sample (seq is 0, if nothing was published yet)
+ *
+ * @return
+ *      - ESP_OK on success
+ */
+esp_err_t esp_lcd_touch_peek_sample(esp_lcd_touch_handle_t tp, esp_lcd_touch_sample_t *sample);
+
+/**
+ * @brief Publish a sample read from the touch controller (for the drivers)
+ *
+ * The sequence number of the sample is set here and the filter is applied to the coordinates. Only one task can
+ * publish samples of the touch (the one calling esp_lcd_touch_read_data), the readers never block it.
+ *
+ * @param tp: Touch handler
+ * @param sample: Sample with points and coordinates (seq is ignored, timestamp_us 0 = current time)
+ */
+void esp_lcd_touch_publish_sample(esp_lcd_touch_handle_t tp, const esp_lcd_touch_sample_t *sample);
+
+/**
+ * @brief Get coordinates of the last published sample (get_xy implementation for the drivers)
+ *
+ * Each published sample is returned only once, next call returns no points until a new sample is published.
+ *
+ * @param tp: Touch handler
+ * @param x: Array of X coordinates
+ * @param y: Array of Y coordinates
+ * @param strength: Array of the strengths (can be NULL)
+ * @param point_num: Count of points touched (equals with count of items in x and y array)
+ * @param max_point_num: Maximum count of touched points to return (equals with max size of x and y array)
+ *
+ * @return
+ *      - Returns true, when touched and coordinates readed. Otherwise returns false.
+ */
+bool esp_lcd_touch_get_sample_xy(esp_lcd_touch_handle_t tp, uint16_t *x, uint16_t *y, uint16_t *strength, uint8_t *point_num, uint8_t max_point_num);
+
 /**
  * @brief Read coordinates from touch controller
  *
@@ -287,6 +391,21 @@ esp_err_t esp_lcd_touch_read_data(esp_lcd_touch_handle_t tp);
 bool esp_lcd_touch_get_coordinates(esp_lcd_touch_handle_t tp, uint16_t *x, uint16_t *y, uint16_t *strength, uint8_t *point_num, uint8_t max_point_num);
 
 
+/**
+ * @brief Set filter of the touch points
+ *
+ * State of the filter is reset, the new configuration is used from the next published sample.
+ *
+ * @note Call it from the task, which reads the touch (esp_lcd_touch_read_data).
+ *
+ * @param tp: Touch handler
+ * @param config: Filter configuration (NULL = filter disabled)
+ *
+ * @return
+ *      - ESP_OK on success
+ */
+esp_err_t esp_lcd_touch_set_filter(esp_lcd_touch_handle_t tp, const esp_lcd_touch_filter_config_t *config);
+
 #if (CONFIG_ESP_LCD_TOUCH_MAX_BUTTONS > 0)
 /**
  * @brief Get button state
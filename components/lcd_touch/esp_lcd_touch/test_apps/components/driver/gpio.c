@@ -0,0 +1,111 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <string.h>
+#include "esp_check.h"
+#include "driver/gpio.h"
+
+static const char *TAG = "gpio";
+
+#define GPIO_CHECK_NUM(gpio_num) ESP_RETURN_ON_FALSE((gpio_num) >= GPIO_NUM_0 && (gpio_num) < GPIO_NUM_MAX, ESP_ERR_INVALID_ARG, TAG, "invalid gpio")
+
+/* Emulated state of one pin */
+typedef struct {
+    uint32_t level;
+    gpio_int_type_t intr_type;
+    bool intr_enabled;
+    gpio_isr_t isr_handler;
+    void *isr_args;
+} gpio_pin_t;
+
+static gpio_pin_t s_pins[GPIO_NUM_MAX];
+
+esp_err_t gpio_config(const gpio_config_t *pGPIOConfig)
+{
+    ESP_RETURN_ON_FALSE(pGPIOConfig, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    for (int i = 0; i < GPIO_NUM_MAX; i++) {
+        if (pGPIOConfig->pin_bit_mask & BIT64(i)) {
+            s_pins[i].intr_type = pGPIOConfig->intr_type;
+            s_pins[i].intr_enabled = (pGPIOConfig->intr_type != GPIO_INTR_DISABLE);
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t gpio_reset_pin(gpio_num_t gpio_num)
+{
+    GPIO_CHECK_NUM(gpio_num);
+    memset(&s_pins[gpio_num], 0, sizeof(gpio_pin_t));
+    return ESP_OK;
+}
+
+esp_err_t gpio_set_level(gpio_num_t gpio_num, uint32_t level)
+{
+    GPIO_CHECK_NUM(gpio_num);
+    gpio_pin_t *pin = &s_pins[gpio_num];
+    level = (level ? 1 : 0);
+    const bool edge = (pin->level != level) &&
+                      ((level && pin->intr_type == GPIO_INTR_POSEDGE) || (!level && pin->intr_type == GPIO_INTR_NEGEDGE));
+    pin->level = level;
+
+    /* The pin is its own input, the edge calls the ISR handler (from the caller's context) */
+    if (edge && pin->intr_enabled && pin->isr_handler) {
+        pin->isr_handler(pin->isr_args);
+    }
+    return ESP_OK;
+}
+
+int gpio_get_level(gpio_num_t gpio_num)
+{
+    if (gpio_num < GPIO_NUM_0 || gpio_num >= GPIO_NUM_MAX) {
+        return 0;
+    }
+    return s_pins[gpio_num].level;
+}
+
+esp_err_t gpio_set_direction(gpio_num_t gpio_num, gpio_mode_t mode)
+{
+    GPIO_CHECK_NUM(gpio_num);
+    return ESP_OK;
+}
+
+esp_err_t gpio_intr_enable(gpio_num_t gpio_num)
+{
+    GPIO_CHECK_NUM(gpio_num);
+    s_pins[gpio_num].intr_enabled = true;
+    return ESP_OK;
+}
+
+esp_err_t gpio_intr_disable(gpio_num_t gpio_num)
+{
+    GPIO_CHECK_NUM(gpio_num);
+    s_pins[gpio_num].intr_enabled = false;
+    return ESP_OK;
+}
+
+esp_err_t gpio_install_isr_service(int intr_alloc_flags)
+{
+    return ESP_OK;
+}
+
+esp_err_t gpio_isr_handler_add(gpio_num_t gpio_num, gpio_isr_t isr_handler, void *args)
+{
+    GPIO_CHECK_NUM(gpio_num);
+    ESP_RETURN_ON_FALSE(isr_handler, ESP_ERR_INVALID_ARG, TAG, "invalid handler");
+    s_pins[gpio_num].isr_handler = isr_handler;
+    s_pins[gpio_num].isr_args = args;
+    return ESP_OK;
+}
+
+esp_err_t gpio_isr_handler_remove(gpio_num_t gpio_num)
+{
+    GPIO_CHECK_NUM(gpio_num);
+    s_pins[gpio_num].isr_handler = NULL;
+    s_pins[gpio_num].isr_args = NULL;
+    return ESP_OK;
+}
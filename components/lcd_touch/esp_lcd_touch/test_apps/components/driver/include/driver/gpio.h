@@ -0,0 +1,83 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Mock of the ESP-IDF GPIO driver API (host build)
+ *
+ * There are no pins on the host. The level of each pin is kept in memory and every pin is its own input: a level
+ * change by gpio_set_level() with the configured edge calls the ISR handler of the pin directly from the caller.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_bit_defs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief GPIO number
+ */
+typedef enum {
+    GPIO_NUM_NC = -1,   /*!< Use to signal not connected to S/W */
+    GPIO_NUM_0 = 0,     /*!< GPIO0, input and output */
+    GPIO_NUM_1 = 1,     /*!< GPIO1, input and output */
+    GPIO_NUM_2 = 2,     /*!< GPIO2, input and output */
+    GPIO_NUM_3 = 3,     /*!< GPIO3, input and output */
+    GPIO_NUM_MAX,
+} gpio_num_t;
+
+/**
+ * @brief GPIO mode
+ */
+typedef enum {
+    GPIO_MODE_DISABLE = 0,      /*!< GPIO mode: disable input and output */
+    GPIO_MODE_INPUT = BIT0,     /*!< GPIO mode: input only */
+    GPIO_MODE_OUTPUT = BIT1,    /*!< GPIO mode: output only mode */
+    GPIO_MODE_OUTPUT_OD = (BIT1 | BIT2),    /*!< GPIO mode: output only with open-drain mode */
+    GPIO_MODE_INPUT_OUTPUT = (BIT0 | BIT1), /*!< GPIO mode: output and input mode */
+} gpio_mode_t;
+
+/**
+ * @brief GPIO interrupt type
+ */
+typedef enum {
+    GPIO_INTR_DISABLE = 0,      /*!< Disable GPIO interrupt */
+    GPIO_INTR_POSEDGE = 1,      /*!< GPIO interrupt type: rising edge */
+    GPIO_INTR_NEGEDGE = 2,      /*!< GPIO interrupt type: falling edge */
+} gpio_int_type_t;
+
+/**
+ * @brief Configuration parameters of GPIO pad for gpio_config function
+ */
+typedef struct {
+    uint64_t pin_bit_mask;      /*!< GPIO pin: set with bit mask, each bit maps to a GPIO */
+    gpio_mode_t mode;           /*!< GPIO mode: set input/output mode */
+    uint32_t pull_up_en;        /*!< GPIO pull-up */
+    uint32_t pull_down_en;      /*!< GPIO pull-down */
+    gpio_int_type_t intr_type;  /*!< GPIO interrupt type */
+} gpio_config_t;
+
+typedef void (*gpio_isr_t)(void *arg);  /*!< GPIO interrupt handler */
+
+esp_err_t gpio_config(const gpio_config_t *pGPIOConfig);
+esp_err_t gpio_reset_pin(gpio_num_t gpio_num);
+esp_err_t gpio_set_level(gpio_num_t gpio_num, uint32_t level);
+int gpio_get_level(gpio_num_t gpio_num);
+esp_err_t gpio_set_direction(gpio_num_t gpio_num, gpio_mode_t mode);
+esp_err_t gpio_intr_enable(gpio_num_t gpio_num);
+esp_err_t gpio_intr_disable(gpio_num_t gpio_num);
+esp_err_t gpio_install_isr_service(int intr_alloc_flags);
+esp_err_t gpio_isr_handler_add(gpio_num_t gpio_num, gpio_isr_t isr_handler, void *args);
+esp_err_t gpio_isr_handler_remove(gpio_num_t gpio_num);
+
+#ifdef __cplusplus
+}
+#endif
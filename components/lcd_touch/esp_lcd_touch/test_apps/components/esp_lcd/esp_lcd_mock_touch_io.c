@@ -0,0 +1,96 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_check.h"
+#include "esp_lcd_panel_io_interface.h"
+#include "esp_lcd_mock_touch_io.h"
+
+static const char *TAG = "touch_mock";
+
+/* __containerof() is not available on the host */
+#define MOCK_CONTAINER_OF(ptr, type, member) ((type *)((char *)(ptr) - offsetof(type, member)))
+
+typedef struct {
+    esp_lcd_panel_io_t base;
+    esp_lcd_mock_touch_io_stats_t stats;
+    uint8_t regs[ESP_LCD_MOCK_TOUCH_IO_REGS];
+} mock_touch_io_t;
+
+static esp_err_t mock_touch_io_rx_param(esp_lcd_panel_io_t *io, int lcd_cmd, void *param, size_t param_size)
+{
+    mock_touch_io_t *mock = MOCK_CONTAINER_OF(io, mock_touch_io_t, base);
+    ESP_RETURN_ON_FALSE(lcd_cmd >= 0 && lcd_cmd + param_size <= ESP_LCD_MOCK_TOUCH_IO_REGS, ESP_ERR_INVALID_ARG, TAG, "invalid register");
+    ESP_RETURN_ON_FALSE(param || param_size == 0, ESP_ERR_INVALID_ARG, TAG, "invalid param");
+
+    memcpy(param, &mock->regs[lcd_cmd], param_size);
+    mock->stats.rx_count++;
+    mock->stats.rx_bytes += param_size;
+
+    return ESP_OK;
+}
+
+static esp_err_t mock_touch_io_tx_param(esp_lcd_panel_io_t *io, int lcd_cmd, const void *param, size_t param_size)
+{
+    mock_touch_io_t *mock = MOCK_CONTAINER_OF(io, mock_touch_io_t, base);
+    ESP_RETURN_ON_FALSE(lcd_cmd >= 0 && lcd_cmd + param_size <= ESP_LCD_MOCK_TOUCH_IO_REGS, ESP_ERR_INVALID_ARG, TAG, "invalid register");
+    ESP_RETURN_ON_FALSE(param || param_size == 0, ESP_ERR_INVALID_ARG, TAG, "invalid param");
+
+    memcpy(&mock->regs[lcd_cmd], param, param_size);
+    mock->stats.tx_count++;
+    mock->stats.tx_bytes += param_size;
+
+    return ESP_OK;
+}
+
+static esp_err_t mock_touch_io_del(esp_lcd_panel_io_t *io)
+{
+    mock_touch_io_t *mock = MOCK_CONTAINER_OF(io, mock_touch_io_t, base);
+    free(mock);
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_new_mock_touch_io(esp_lcd_panel_io_handle_t *ret_io)
+{
+    ESP_RETURN_ON_FALSE(ret_io, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+
+    mock_touch_io_t *mock = calloc(1, sizeof(mock_touch_io_t));
+    ESP_RETURN_ON_FALSE(mock, ESP_ERR_NO_MEM, TAG, "no mem for mock touch io");
+
+    mock->base.rx_param = mock_touch_io_rx_param;
+    mock->base.tx_param = mock_touch_io_tx_param;
+    mock->base.del = mock_touch_io_del;
+
+    *ret_io = &mock->base;
+    return ESP_OK;
+}
+
+uint8_t *esp_lcd_mock_touch_io_get_regs(esp_lcd_panel_io_handle_t io)
+{
+    if (io == NULL) {
+        return NULL;
+    }
+    mock_touch_io_t *mock = MOCK_CONTAINER_OF(io, mock_touch_io_t, base);
+    return mock->regs;
+}
+
+esp_err_t esp_lcd_mock_touch_io_get_stats(esp_lcd_panel_io_handle_t io, esp_lcd_mock_touch_io_stats_t *stats)
+{
+    ESP_RETURN_ON_FALSE(io && stats, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    mock_touch_io_t *mock = MOCK_CONTAINER_OF(io, mock_touch_io_t, base);
+    *stats = mock->stats;
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_mock_touch_io_reset_stats(esp_lcd_panel_io_handle_t io)
+{
+    ESP_RETURN_ON_FALSE(io, ESP_ERR_INVALID_ARG, TAG, "invalid argument");
+    mock_touch_io_t *mock = MOCK_CONTAINER_OF(io, mock_touch_io_t, base);
+    memset(&mock->stats, 0, sizeof(mock->stats));
+    return ESP_OK;
+}
@@ -0,0 +1,82 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Mock panel IO of an I2C touch controller (host build)
+ *
+ * The controller is a map of 16-bit addressed registers. `esp_lcd_panel_io_rx_param()` reads registers from
+ * the `lcd_cmd` address on, `esp_lcd_panel_io_tx_param()` writes them. Every call is counted as one bus transaction,
+ * the same as the I2C panel IO does it (register address write and repeated-start read in one transaction).
+ *
+ * Tests fill the registers with the touch reports, which would be produced by the controller.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_lcd_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ESP_LCD_MOCK_TOUCH_IO_REGS  (0x10000)   /*!< Count of the registers (16-bit register address) */
+
+/**
+ * @brief Accumulated bus statistics
+ */
+typedef struct {
+    uint32_t rx_count;      /*!< Number of read transactions */
+    uint32_t tx_count;      /*!< Number of write transactions */
+    uint64_t rx_bytes;      /*!< Read bytes (without register address) */
+    uint64_t tx_bytes;      /*!< Written bytes (without register address) */
+} esp_lcd_mock_touch_io_stats_t;
+
+/**
+ * @brief Create a new mock touch controller panel IO
+ *
+ * @param[out] ret_io  Returned panel IO handle, released by `esp_lcd_panel_io_del()`
+ * @return
+ *      - ESP_OK                on success
+ *      - ESP_ERR_INVALID_ARG   if parameter is invalid
+ *      - ESP_ERR_NO_MEM        if out of memory
+ */
+esp_err_t esp_lcd_new_mock_touch_io(esp_lcd_panel_io_handle_t *ret_io);
+
+/**
+ * @brief Get the registers of the mock touch controller
+ *
+ * @param io  Mock touch panel IO handle
+ * @return Array of ESP_LCD_MOCK_TOUCH_IO_REGS registers (valid until the panel IO is deleted)
+ */
+uint8_t *esp_lcd_mock_touch_io_get_regs(esp_lcd_panel_io_handle_t io);
+
+/**
+ * @brief Get accumulated statistics
+ *
+ * @param[in]  io     Mock touch panel IO handle
+ * @param[out] stats  Statistics
+ * @return
+ *      - ESP_OK                on success
+ *      - ESP_ERR_INVALID_ARG   if parameter is invalid
+ */
+esp_err_t esp_lcd_mock_touch_io_get_stats(esp_lcd_panel_io_handle_t io, esp_lcd_mock_touch_io_stats_t *stats);
+
+/**
+ * @brief Clear statistics
+ *
+ * @param io  Mock touch panel IO handle
+ * @return
+ *      - ESP_OK                on success
+ *      - ESP_ERR_INVALID_ARG   if parameter is invalid
+ */
+esp_err_t esp_lcd_mock_touch_io_reset_stats(esp_lcd_panel_io_handle_t io);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,61 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Mock of the ESP-IDF esp_lcd panel IO API (host build)
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include "esp_err.h"
+#include "esp_lcd_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Transmit LCD command and corresponding parameters
+ *
+ * @param io            LCD panel IO handle
+ * @param lcd_cmd       The specific LCD command, set to -1 if no command needed
+ * @param param         Buffer that holds the command specific parameters, set to NULL if no parameter is needed
+ * @param param_size    Size of `param` in memory, in bytes, set to zero if no parameter is needed
+ * @return
+ *      - ESP_ERR_INVALID_ARG   if parameter is invalid
+ *      - ESP_OK                on success
+ */
+esp_err_t esp_lcd_panel_io_tx_param(esp_lcd_panel_io_handle_t io, int lcd_cmd, const void *param, size_t param_size);
+
+/**
+ * @brief Transmit LCD command and receive corresponding parameters
+ *
+ * @param io            LCD panel IO handle
+ * @param lcd_cmd       The specific LCD command, set to -1 if no command needed
+ * @param param         Buffer to hold the received parameters
+ * @param param_size    Size of `param` buffer
+ * @return
+ *      - ESP_ERR_INVALID_ARG   if parameter is invalid
+ *      - ESP_ERR_NOT_SUPPORTED if read is not supported by transport
+ *      - ESP_OK                on success
+ */
+esp_err_t esp_lcd_panel_io_rx_param(esp_lcd_panel_io_handle_t io, int lcd_cmd, void *param, size_t param_size);
+
+/**
+ * @brief Destroy LCD panel IO handle (deinitialize panel and free all corresponding resource)
+ *
+ * @param io    LCD panel IO handle
+ * @return
+ *      - ESP_ERR_INVALID_ARG   if parameter is invalid
+ *      - ESP_OK                on success
+ */
+esp_err_t esp_lcd_panel_io_del(esp_lcd_panel_io_handle_t io);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,247 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+#include "esp_err.h"
+#include "esp_lcd_touch.h"
+
+#include "unity.h"
+
+#define TEST_TOUCH_H_RES    (800)
+#define TEST_TOUCH_V_RES    (480)
+#define TEST_PERIOD_US      (10000) /* Sampling period of the synthetic traces */
+#define TEST_START_US       (1000000)
+
+typedef struct {
+    uint16_t x;
+    uint16_t y;
+} test_point_t;
+
+/* Touch without controller, the synthetic samples are published directly */
+static esp_lcd_touch_handle_t test_filter_touch_new(const esp_lcd_touch_filter_config_t *filter)
+{
+    esp_lcd_touch_handle_t tp = calloc(1, sizeof(esp_lcd_touch_t));
+    TEST_ASSERT_NOT_NULL(tp);
+
+    tp->get_xy = esp_lcd_touch_get_sample_xy;
+    tp->config.x_max = TEST_TOUCH_H_RES;
+    tp->config.y_max = TEST_TOUCH_V_RES;
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_touch_set_filter(tp, filter));
+
+    return tp;
+}
+
+/* Publish one sample of the trace and return the filtered one */
+static void test_filter_publish(esp_lcd_touch_handle_t tp, int i, const test_point_t *points, uint8_t cnt, esp_lcd_touch_sample_t *out)
+{
+    esp_lcd_touch_sample_t sample = {
+        .timestamp_us = TEST_START_US + (int64_t)i * TEST_PERIOD_US,
+        .points = cnt,
+    };
+    for (int j = 0; j < cnt; j++) {
+        sample.coords[j].x = points[j].x;
+        sample.coords[j].y = points[j].y;
+    }
+    esp_lcd_touch_publish_sample(tp, &sample);
+
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_touch_peek_sample(tp, out));
+    TEST_ASSERT_EQUAL_UINT8(cnt, out->points);
+}
+
+/* Uniform noise in range <-amplitude, amplitude> */
+static int test_noise(int amplitude)
+{
+    return (rand() % (2 * amplitude + 1)) - amplitude;
+}
+
+TEST_CASE("Touch filter disabled keeps coordinates", "[touch][filter]")
+{
+    const esp_lcd_touch_filter_config_t filter = {0};
+    esp_lcd_touch_handle_t tp = test_filter_touch_new(&filter);
+    esp_lcd_touch_sample_t out;
+
+    srand(1);
+    for (int i = 0; i < 100; i++) {
+        const test_point_t p = {.x = 400 + test_noise(4), .y = 240 + test_noise(4)};
+        test_filter_publish(tp, i, &p, 1, &out);
+        TEST_ASSERT_EQUAL_UINT16(p.x, out.coords[0].x);
+        TEST_ASSERT_EQUAL_UINT16(p.y, out.coords[0].y);
+    }
+
+    free(tp);
+}
+
+TEST_CASE("Touch filter deadband removes jitter", "[touch][filter]")
+{
+    const esp_lcd_touch_filter_config_t filter = {
+        .deadband = 2,
+    };
+    esp_lcd_touch_handle_t tp = test_filter_touch_new(&filter);
+    esp_lcd_touch_sample_t out;
+
+    /* Held touch with jitter: position does not change at all */
+    srand(1);
+    const test_point_t first = {.x = 400, .y = 240};
+    test_filter_publish(tp, 0, &first, 1, &out);
+    for (int i = 1; i < 100; i++) {
+        const test_point_t p = {.x = 400 + test_noise(2), .y = 240 + test_noise(2)};
+        test_filter_publish(tp, i, &p, 1, &out);
+        TEST_ASSERT_EQUAL_UINT16(400, out.coords[0].x);
+        TEST_ASSERT_EQUAL_UINT16(240, out.coords[0].y);
+    }
+
+    /* Moving touch is followed with maximum deadband lag */
+    for (int i = 0; i < 50; i++) {
+        const test_point_t p = {.x = 400 + (i * 5), .y = 240 - (i * 3)};
+        test_filter_publish(tp, 100 + i, &p, 1, &out);
+        TEST_ASSERT_INT_WITHIN(filter.deadband, p.x, out.coords[0].x);
+        TEST_ASSERT_INT_WITHIN(filter.deadband, p.y, out.coords[0].y);
+    }
+
+    free(tp);
+}
+
+TEST_CASE("Touch filter smoother reduces jitter", "[touch][filter]")
+{
+    const esp_lcd_touch_filter_config_t filter = {
+        .min_cutoff_mhz = 1000,
+    };
+    esp_lcd_touch_handle_t tp = test_filter_touch_new(&filter);
+    esp_lcd_touch_sample_t out;
+    uint32_t in_sq = 0;
+    uint32_t out_sq = 0;
+
+    srand(1);
+    for (int i = 0; i < 300; i++) {
+        const test_point_t p = {.x = 400 + test_noise(4), .y = 240 + test_noise(4)};
+        test_filter_publish(tp, i, &p, 1, &out);
+
+        /* Squared deviations from the touch position, after the smoother settled */
+        if (i >= 100) {
+            in_sq += (p.x - 400) * (p.x - 400) + (p.y - 240) * (p.y - 240);
+            out_sq += (out.coords[0].x - 400) * (out.coords[0].x - 400) + (out.coords[0].y - 240) * (out.coords[0].y - 240);
+        }
+    }
+    printf("Smoother jitter: input %"PRIu32", output %"PRIu32" (sum of squared deviations)\n", in_sq, out_sq);
+
+    /* Standard deviation at least halved */
+    TEST_ASSERT_LESS_THAN_UINT32(in_sq / 4, out_sq);
+
+    free(tp);
+}
+
+TEST_CASE("Touch filter 1-euro smoother lags less than IIR", "[touch][filter]")
+{
+    const esp_lcd_touch_filter_config_t filter_iir = {
+        .min_cutoff_mhz = 1000,
+    };
+    const esp_lcd_touch_filter_config_t filter_euro = {
+        .min_cutoff_mhz = 1000,
+        .beta = 20,
+    };
+    const esp_lcd_touch_filter_config_t *filters[] = {&filter_iir, &filter_euro};
+    int lag[2];
+
+    /* Drag with 1000 px/s */
+    for (int f = 0; f < 2; f++) {
+        esp_lcd_touch_handle_t tp = test_filter_touch_new(filters[f]);
+        esp_lcd_touch_sample_t out;
+        test_point_t p = {0};
+
+        for (int i = 0; i < 60; i++) {
+            p.x = 50 + (i * 10);
+            p.y = 240;
+            test_filter_publish(tp, i, &p, 1, &out);
+        }
+        lag[f] = p.x - out.coords[0].x;
+        free(tp);
+    }
+    printf("Lag of 1000 px/s drag: IIR %d px, 1-euro %d px\n", lag[0], lag[1]);
+
+    TEST_ASSERT_GREATER_THAN_INT(0, lag[1]);
+    TEST_ASSERT_LESS_THAN_INT(lag[0] / 4, lag[1]);
+}
+
+TEST_CASE("Touch filter prediction compensates latency", "[touch][filter]")
+{
+    const esp_lcd_touch_filter_config_t filter = {
+        .predict_ms = 20,
+    };
+    esp_lcd_touch_handle_t tp = test_filter_touch_new(&filter);
+    esp_lcd_touch_sample_t out;
+    test_point_t p = {0};
+
+    /* Drag with 500 px/s right and 250 px/s up, position 20 ms ahead is 10 px right and 5 px up */
+    for (int i = 0; i < 100; i++) {
+        p.x = 100 + (i * 5);
+        p.y = 400 - (i * 5 / 2);
+        test_filter_publish(tp, i, &p, 1, &out);
+    }
+    printf("Prediction 20 ms: touch %d,%d predicted %d,%d\n", p.x, p.y, out.coords[0].x, out.coords[0].y);
+
+    TEST_ASSERT_INT_WITHIN(1, p.x + 10, out.coords[0].x);
+    TEST_ASSERT_INT_WITHIN(1, p.y - 5, out.coords[0].y);
+
+    /* Prediction is clamped to the touch area */
+    for (int i = 0; i < 10; i++) {
+        p.x = TEST_TOUCH_H_RES - 5 + (i > 5 ? 5 : i);
+        test_filter_publish(tp, 100 + i, &p, 1, &out);
+        TEST_ASSERT_LESS_OR_EQUAL_UINT16(TEST_TOUCH_H_RES, out.coords[0].x);
+    }
+
+    free(tp);
+}
+
+TEST_CASE("Touch filter tracks each touch point", "[touch][filter]")
+{
+    const esp_lcd_touch_filter_config_t filter = {
+        .deadband = 1,
+        .min_cutoff_mhz = 500,
+        .beta = 10,
+    };
+    esp_lcd_touch_handle_t tp = test_filter_touch_new(&filter);
+    esp_lcd_touch_sample_t out;
+    int i = 0;
+
+    /* Two held touches, the controller swaps their order in every other sample */
+    srand(1);
+    for (; i < 100; i++) {
+        const test_point_t a = {.x = 100 + test_noise(3), .y = 100 + test_noise(3)};
+        const test_point_t b = {.x = 600 + test_noise(3), .y = 400 + test_noise(3)};
+        const test_point_t points[2] = {(i & 1) ? b : a, (i & 1) ? a : b};
+        const test_point_t centers[2] = {{.x = (i & 1) ? 600 : 100, .y = (i & 1) ? 400 : 100}, {.x = (i & 1) ? 100 : 600, .y = (i & 1) ? 100 : 400}};
+        test_filter_publish(tp, i, points, 2, &out);
+        for (int j = 0; j < 2; j++) {
+            TEST_ASSERT_INT_WITHIN(3, centers[j].x, out.coords[j].x);
+            TEST_ASSERT_INT_WITHIN(3, centers[j].y, out.coords[j].y);
+        }
+    }
+
+    /* First touch is released, the second one is reported as the first point */
+    for (; i < 110; i++) {
+        const test_point_t b = {.x = 600, .y = 400};
+        test_filter_publish(tp, i, &b, 1, &out);
+        TEST_ASSERT_INT_WITHIN(3, b.x, out.coords[0].x);
+        TEST_ASSERT_INT_WITHIN(3, b.y, out.coords[0].y);
+    }
+
+    /* New touch starts at its own position */
+    const test_point_t points[2] = {{.x = 300, .y = 50}, {.x = 600, .y = 400}};
+    test_filter_publish(tp, i++, points, 2, &out);
+    TEST_ASSERT_EQUAL_UINT16(300, out.coords[0].x);
+    TEST_ASSERT_EQUAL_UINT16(50, out.coords[0].y);
+
+    /* Release of all touches and new touch elsewhere: no smoothing from the old position */
+    test_filter_publish(tp, i++, NULL, 0, &out);
+    const test_point_t c = {.x = 700, .y = 20};
+    test_filter_publish(tp, i++, &c, 1, &out);
+    TEST_ASSERT_EQUAL_UINT16(c.x, out.coords[0].x);
+    TEST_ASSERT_EQUAL_UINT16(c.y, out.coords[0].y);
+
+    free(tp);
+}
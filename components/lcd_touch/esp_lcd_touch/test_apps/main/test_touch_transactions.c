@@ -0,0 +1,234 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdio.h>
+#include <inttypes.h>
+#include <string.h>
+#include "esp_err.h"
+#include "esp_lcd_panel_io.h"
+#include "esp_lcd_mock_touch_io.h"
+#include "esp_lcd_touch.h"
+#include "esp_lcd_touch_gt911.h"
+#include "esp_lcd_touch_gt1151.h"
+#include "esp_lcd_touch_ft5x06.h"
+
+#include "unity.h"
+
+#define TEST_TOUCH_H_RES    (800)
+#define TEST_TOUCH_V_RES    (480)
+#define TEST_TOUCH_POINTS   (2)     /* Points of the held touch */
+#define TEST_SAMPLES        (100)   /* Read reports in the idle and hold phase */
+
+/* Goodix registers */
+#define TEST_GOODIX_PRODUCT_ID_REG  (0x8140)
+#define TEST_GOODIX_READ_XY_REG     (0x814E)
+#define TEST_GOODIX_POINT_LEN       (8)
+
+/* FocalTech registers */
+#define TEST_FT5x06_TOUCH_POINTS    (0x02)
+#define TEST_FT5x06_POINT_LEN       (6)
+
+typedef struct {
+    uint16_t x;
+    uint16_t y;
+} test_point_t;
+
+/**
+ * @brief Touch controller under test
+ */
+typedef struct {
+    const char *name;
+    esp_err_t (*new_touch)(const esp_lcd_panel_io_handle_t io, const esp_lcd_touch_config_t *config, esp_lcd_touch_handle_t *tp);
+    void (*prepare)(uint8_t *regs);     /* Registers read by the initialization of the driver */
+    void (*set_report)(uint8_t *regs, const test_point_t *points, uint8_t cnt);    /* New report of the controller */
+    void (*set_idle)(uint8_t *regs);    /* Controller has nothing to report */
+    uint32_t idle_trans;    /* Expected transactions per sample without touch */
+    uint32_t hold_trans;    /* Expected transactions per sample of a held touch */
+} test_touch_driver_t;
+
+static void test_gt911_set_report(uint8_t *regs, const test_point_t *points, uint8_t cnt)
+{
+    regs[TEST_GOODIX_READ_XY_REG] = 0x80 | cnt;
+    for (int i = 0; i < cnt; i++) {
+        uint8_t *p = &regs[TEST_GOODIX_READ_XY_REG + 1 + (i * TEST_GOODIX_POINT_LEN)];
+        p[0] = i;                   /* Track ID */
+        p[1] = points[i].x & 0xff;
+        p[2] = points[i].x >> 8;
+        p[3] = points[i].y & 0xff;
+        p[4] = points[i].y >> 8;
+        p[5] = 20;                  /* Size */
+        p[6] = 0;
+    }
+}
+
+static void test_goodix_set_idle(uint8_t *regs)
+{
+    regs[TEST_GOODIX_READ_XY_REG] = 0;
+}
+
+static void test_gt1151_prepare(uint8_t *regs)
+{
+    /* Product ID, patch, mask and sensor ID */
+    const uint8_t product_id[11] = {'1', '1', '5', '8', 0x00, 0x01, 0x02, 0x00, 0x10, 0x00, 0x01};
+    memcpy(&regs[TEST_GOODIX_PRODUCT_ID_REG], product_id, sizeof(product_id));
+}
+
+static void test_gt1151_set_report(uint8_t *regs, const test_point_t *points, uint8_t cnt)
+{
+    /* Same records as GT911, followed by the key value and checksum */
+    test_gt911_set_report(regs, points, cnt);
+
+    uint8_t *report = &regs[TEST_GOODIX_READ_XY_REG];
+    const int len = 1 + (cnt * TEST_GOODIX_POINT_LEN);
+    uint8_t checksum = 0;
+    report[len] = 0;
+    for (int i = 0; i <= len; i++) {
+        checksum += report[i];
+    }
+    report[len + 1] = -checksum;
+}
+
+static void test_ft5x06_set_report(uint8_t *regs, const test_point_t *points, uint8_t cnt)
+{
+    regs[TEST_FT5x06_TOUCH_POINTS] = cnt;
+    for (int i = 0; i < cnt; i++) {
+        uint8_t *p = &regs[TEST_FT5x06_TOUCH_POINTS + 1 + (i * TEST_FT5x06_POINT_LEN)];
+        p[0] = 0x80 | (points[i].x >> 8);   /* Event flag: contact */
+        p[1] = points[i].x & 0xff;
+        p[2] = (i << 4) | (points[i].y >> 8); /* Touch ID */
+        p[3] = points[i].y & 0xff;
+    }
+}
+
+static void test_ft5x06_set_idle(uint8_t *regs)
+{
+    regs[TEST_FT5x06_TOUCH_POINTS] = 0;
+}
+
+/**
+ * @brief Read `samples` touch reports and return count of the bus transactions
+ *
+ * Controller produces a new report with `cnt` points before each read, negative `cnt` means no new report.
+ * Decoded coordinates are checked against the report.
+ */
+static uint32_t test_touch_read(esp_lcd_panel_io_handle_t io, esp_lcd_touch_handle_t tp, const test_touch_driver_t *drv,
+                                int cnt, int samples, uint64_t *bytes)
+{
+    uint8_t *regs = esp_lcd_mock_touch_io_get_regs(io);
+    esp_lcd_mock_touch_io_stats_t stats;
+
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_mock_touch_io_reset_stats(io));
+    for (int i = 0; i < samples; i++) {
+        test_point_t points[TEST_TOUCH_POINTS];
+        for (int j = 0; j < cnt; j++) {
+            points[j].x = 100 + (j * 200) + i;
+            points[j].y = 50 + (j * 100) + i;
+        }
+        if (cnt >= 0) {
+            drv->set_report(regs, points, cnt);
+        } else {
+            drv->set_idle(regs);
+        }
+        TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_touch_read_data(tp));
+
+        uint16_t x[TEST_TOUCH_POINTS];
+        uint16_t y[TEST_TOUCH_POINTS];
+        uint8_t num = 0;
+        const bool pressed = esp_lcd_touch_get_coordinates(tp, x, y, NULL, &num, TEST_TOUCH_POINTS);
+        if (cnt > 0) {
+            TEST_ASSERT_TRUE(pressed);
+            TEST_ASSERT_EQUAL_UINT8(cnt, num);
+            for (int j = 0; j < cnt; j++) {
+                TEST_ASSERT_EQUAL_UINT16(points[j].x, x[j]);
+                TEST_ASSERT_EQUAL_UINT16(points[j].y, y[j]);
+            }
+        } else {
+            TEST_ASSERT_FALSE(pressed);
+        }
+    }
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_mock_touch_io_get_stats(io, &stats));
+
+    if (bytes) {
+        *bytes = stats.rx_bytes + stats.tx_bytes;
+    }
+    return stats.rx_count + stats.tx_count;
+}
+
+static void test_touch_transactions(const test_touch_driver_t *drv)
+{
+    esp_lcd_panel_io_handle_t io = NULL;
+    esp_lcd_touch_handle_t tp = NULL;
+    uint64_t hold_bytes = 0;
+
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_new_mock_touch_io(&io));
+    if (drv->prepare) {
+        drv->prepare(esp_lcd_mock_touch_io_get_regs(io));
+    }
+
+    const esp_lcd_touch_config_t tp_cfg = {
+        .x_max = TEST_TOUCH_H_RES,
+        .y_max = TEST_TOUCH_V_RES,
+        .rst_gpio_num = GPIO_NUM_NC,
+        .int_gpio_num = GPIO_NUM_NC,
+    };
+    TEST_ASSERT_EQUAL(ESP_OK, drv->new_touch(io, &tp_cfg, &tp));
+
+    const uint32_t idle = test_touch_read(io, tp, drv, -1, TEST_SAMPLES, NULL);
+    const uint32_t press = test_touch_read(io, tp, drv, TEST_TOUCH_POINTS, 1, NULL);
+    const uint32_t hold = test_touch_read(io, tp, drv, TEST_TOUCH_POINTS, TEST_SAMPLES, &hold_bytes);
+    const uint32_t release = test_touch_read(io, tp, drv, 0, 1, NULL);
+    const uint32_t idle_after = test_touch_read(io, tp, drv, -1, TEST_SAMPLES, NULL);
+
+    printf("%s | idle %.2f | press %"PRIu32" | hold %.2f | release %"PRIu32" transactions/sample | hold %.1f B/sample\n",
+           drv->name, (float)idle / TEST_SAMPLES, press, (float)hold / TEST_SAMPLES, release, (float)hold_bytes / TEST_SAMPLES);
+
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_touch_del(tp));
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_panel_io_del(io));
+
+    TEST_ASSERT_EQUAL_UINT32(drv->idle_trans * TEST_SAMPLES, idle);
+    TEST_ASSERT_EQUAL_UINT32(drv->hold_trans * TEST_SAMPLES, hold);
+    TEST_ASSERT_EQUAL_UINT32(drv->idle_trans * TEST_SAMPLES, idle_after);
+}
+
+TEST_CASE("Touch transactions per sample GT911", "[touch][transactions]")
+{
+    const test_touch_driver_t drv = {
+        .name = "GT911",
+        .new_touch = esp_lcd_touch_new_i2c_gt911,
+        .set_report = test_gt911_set_report,
+        .set_idle = test_goodix_set_idle,
+        .idle_trans = 1,    /* Status */
+        .hold_trans = 2,    /* Status with points, clear */
+    };
+    test_touch_transactions(&drv);
+}
+
+TEST_CASE("Touch transactions per sample GT1151", "[touch][transactions]")
+{
+    const test_touch_driver_t drv = {
+        .name = "GT1151",
+        .new_touch = esp_lcd_touch_new_i2c_gt1151,
+        .prepare = test_gt1151_prepare,
+        .set_report = test_gt1151_set_report,
+        .set_idle = test_goodix_set_idle,
+        .idle_trans = 1,    /* Status */
+        .hold_trans = 2,    /* Status with points and checksum, clear */
+    };
+    test_touch_transactions(&drv);
+}
+
+TEST_CASE("Touch transactions per sample FT5x06", "[touch][transactions]")
+{
+    const test_touch_driver_t drv = {
+        .name = "FT5x06",
+        .new_touch = esp_lcd_touch_new_i2c_ft5x06,
+        .set_report = test_ft5x06_set_report,
+        .set_idle = test_ft5x06_set_idle,
+        .idle_trans = 1,    /* Count of points */
+        .hold_trans = 1,    /* Count of points with points */
+    };
+    test_touch_transactions(&drv);
+}
@@ -0,0 +1,318 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdio.h>
+#include <inttypes.h>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_lcd_panel_io.h"
+#include "esp_lcd_mock_touch_io.h"
+#include "esp_lcd_touch.h"
+#include "esp_lcd_touch_gt911.h"
+#include "esp_lcd_touch_virtual.h"
+
+#include "unity.h"
+
+#define TEST_TOUCH_H_RES        (800)
+#define TEST_TOUCH_V_RES        (480)
+#define TEST_TRACE_SAMPLES      (20)
+#define TEST_TRACE_PERIOD_US    (10000)
+#define TEST_TRACE_FILE         "test_touch_trace.txt"
+
+/* Goodix registers */
+#define TEST_GOODIX_READ_XY_REG     (0x814E)
+#define TEST_GOODIX_POINT_LEN       (8)
+
+static volatile uint32_t test_interrupts;
+
+static void test_virtual_interrupt_callback(esp_lcd_touch_handle_t tp)
+{
+    test_interrupts++;
+}
+
+/* Drag of two points, then release */
+static void test_virtual_trace_create(esp_lcd_touch_virtual_sample_t *trace)
+{
+    for (int i = 0; i < TEST_TRACE_SAMPLES; i++) {
+        trace[i] = (esp_lcd_touch_virtual_sample_t) {
+            .time_us = (i + 1) * TEST_TRACE_PERIOD_US,
+            .points = (i < TEST_TRACE_SAMPLES - 1 ? 2 : 0),
+            .coords = {{.x = 100 + (i * 10), .y = 200, .strength = 30}, {.x = 600 - (i * 10), .y = 300, .strength = 40}},
+        };
+    }
+}
+
+static void test_virtual_check_sample(const esp_lcd_touch_virtual_sample_t *expected, const esp_lcd_touch_sample_t *sample)
+{
+    TEST_ASSERT_EQUAL_UINT8(expected->points, sample->points);
+    for (int j = 0; j < expected->points; j++) {
+        TEST_ASSERT_EQUAL_UINT16(expected->coords[j].x, sample->coords[j].x);
+        TEST_ASSERT_EQUAL_UINT16(expected->coords[j].y, sample->coords[j].y);
+        TEST_ASSERT_EQUAL_UINT16(expected->coords[j].strength, sample->coords[j].strength);
+    }
+}
+
+TEST_CASE("Virtual touch plays trace with interrupt", "[touch][virtual]")
+{
+    esp_lcd_touch_virtual_sample_t trace[TEST_TRACE_SAMPLES];
+    esp_lcd_touch_handle_t tp = NULL;
+    esp_lcd_touch_virtual_status_t status;
+
+    test_virtual_trace_create(trace);
+    const esp_lcd_touch_virtual_config_t virtual_cfg = {
+        .samples = trace,
+        .samples_count = TEST_TRACE_SAMPLES,
+    };
+    const esp_lcd_touch_config_t tp_cfg = {
+        .x_max = TEST_TOUCH_H_RES,
+        .y_max = TEST_TOUCH_V_RES,
+        .rst_gpio_num = GPIO_NUM_NC,
+        .int_gpio_num = GPIO_NUM_0,
+        .interrupt_callback = test_virtual_interrupt_callback,
+        .driver_data = (void *) &virtual_cfg,
+    };
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_touch_new_virtual(&tp_cfg, &tp));
+
+    test_interrupts = 0;
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_touch_virtual_start(tp));
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_touch_virtual_get_status(tp, &status));
+    TEST_ASSERT_TRUE(status.running);
+
+    /* The touch is read after each interrupt, as the application does it */
+    uint32_t handled = 0;
+    int last = -1;
+    while (status.running || handled != test_interrupts) {
+        vTaskDelay(pdMS_TO_TICKS(1));
+        if (handled == test_interrupts) {
+            TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_touch_virtual_get_status(tp, &status));
+            continue;
+        }
+        handled = test_interrupts;
+
+        TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_touch_read_data(tp));
+        esp_lcd_touch_sample_t sample;
+        TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_touch_peek_sample(tp, &sample));
+
+        /* Timestamp is the time of the sample in the trace */
+        const int i = (sample.timestamp_us - status.start_us) / TEST_TRACE_PERIOD_US - 1;
+        TEST_ASSERT_GREATER_THAN_INT(last, i);
+        TEST_ASSERT_LESS_THAN_INT(TEST_TRACE_SAMPLES, i);
+        TEST_ASSERT_EQUAL_INT64(status.start_us + trace[i].time_us, sample.timestamp_us);
+        test_virtual_check_sample(&trace[i], &sample);
+        last = i;
+    }
+    printf("Virtual touch: %"PRIu32" samples reported by %"PRIu32" interrupts\n", status.reported, handled);
+
+    TEST_ASSERT_EQUAL_UINT32(TEST_TRACE_SAMPLES, status.reported);
+    TEST_ASSERT_EQUAL_UINT32(1, status.loops);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, handled);
+    /* The release is always reported */
+    TEST_ASSERT_EQUAL_INT(TEST_TRACE_SAMPLES - 1, last);
+
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_touch_del(tp));
+}
+
+TEST_CASE("Virtual touch reports held touch by every read", "[touch][virtual]")
+{
+    const esp_lcd_touch_virtual_sample_t trace[] = {
+        {.time_us = 0, .points = 1, .coords = {{.x = 10, .y = 20}}},
+        {.time_us = 100000, .points = 0},
+    };
+    const esp_lcd_touch_virtual_config_t virtual_cfg = {
+        .samples = trace,
+        .samples_count = sizeof(trace) / sizeof(trace[0]),
+    };
+    const esp_lcd_touch_config_t tp_cfg = {
+        .x_max = TEST_TOUCH_H_RES,
+        .y_max = TEST_TOUCH_V_RES,
+        .rst_gpio_num = GPIO_NUM_NC,
+        .int_gpio_num = GPIO_NUM_NC,
+        .driver_data = (void *) &virtual_cfg,
+    };
+    esp_lcd_touch_handle_t tp = NULL;
+    uint16_t x = 0;
+    uint16_t y = 0;
+    uint8_t cnt = 0;
+
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_touch_new_virtual(&tp_cfg, &tp));
+
+    /* Nothing before the start */
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_touch_read_data(tp));
+    TEST_ASSERT_FALSE(esp_lcd_touch_get_coordinates(tp, &x, &y, NULL, &cnt, 1));
+
+    /* The first sample is due at the start */
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_touch_virtual_start(tp));
+    for (int i = 0; i < 3; i++) {
+        TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_touch_read_data(tp));
+        TEST_ASSERT_TRUE(esp_lcd_touch_get_coordinates(tp, &x, &y, NULL, &cnt, 1));
+        TEST_ASSERT_EQUAL_UINT8(1, cnt);
+        TEST_ASSERT_EQUAL_UINT16(10, x);
+        TEST_ASSERT_EQUAL_UINT16(20, y);
+    }
+
+    /* Released touch is not reported again */
+    vTaskDelay(pdMS_TO_TICKS(150));
+    for (int i = 0; i < 2; i++) {
+        TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_touch_read_data(tp));
+        TEST_ASSERT_FALSE(esp_lcd_touch_get_coordinates(tp, &x, &y, NULL, &cnt, 1));
+    }
+
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_touch_del(tp));
+}
+
+static void test_gt911_set_report(uint8_t *regs, uint16_t x, uint16_t y, uint8_t cnt)
+{
+    regs[TEST_GOODIX_READ_XY_REG] = 0x80 | cnt;
+    if (cnt > 0) {
+        uint8_t *p = &regs[TEST_GOODIX_READ_XY_REG + 1];
+        p[0] = 0;                   /* Track ID */
+        p[1] = x & 0xff;
+        p[2] = x >> 8;
+        p[3] = y & 0xff;
+        p[4] = y >> 8;
+        p[5] = 20;                  /* Size */
+        p[6] = 0;
+    }
+}
+
+TEST_CASE("Virtual touch records driver and plays saved trace", "[touch][virtual]")
+{
+    esp_lcd_panel_io_handle_t io = NULL;
+    esp_lcd_touch_handle_t gt911 = NULL;
+    esp_lcd_touch_handle_t recorder = NULL;
+    esp_lcd_touch_handle_t player = NULL;
+
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_new_mock_touch_io(&io));
+    uint8_t *regs = esp_lcd_mock_touch_io_get_regs(io);
+    const esp_lcd_touch_config_t tp_cfg = {
+        .x_max = TEST_TOUCH_H_RES,
+        .y_max = TEST_TOUCH_V_RES,
+        .rst_gpio_num = GPIO_NUM_NC,
+        .int_gpio_num = GPIO_NUM_NC,
+    };
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_touch_new_i2c_gt911(io, &tp_cfg, &gt911));
+
+    /* Recorder is read instead of the driver */
+    const esp_lcd_touch_virtual_config_t record_cfg = {
+        .source = gt911,
+        .samples_count = 16,
+    };
+    const esp_lcd_touch_config_t record_tp_cfg = {
+        .driver_data = (void *) &record_cfg,
+    };
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_touch_new_virtual(&record_tp_cfg, &recorder));
+
+    /* Drag, release and idle controller */
+    for (int i = 0; i < 8; i++) {
+        uint16_t x = 0;
+        uint16_t y = 0;
+        uint8_t cnt = 0;
+        test_gt911_set_report(regs, 100 + (i * 20), 50 + i, (i < 6 ? 1 : 0));
+        if (i == 7) {
+            regs[TEST_GOODIX_READ_XY_REG] = 0;
+        }
+        TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_touch_read_data(recorder));
+        const bool pressed = esp_lcd_touch_get_coordinates(recorder, &x, &y, NULL, &cnt, 1);
+        TEST_ASSERT_EQUAL(i < 6, pressed);
+        if (pressed) {
+            TEST_ASSERT_EQUAL_UINT16(100 + (i * 20), x);
+            TEST_ASSERT_EQUAL_UINT16(50 + i, y);
+        }
+        vTaskDelay(pdMS_TO_TICKS(2));
+    }
+
+    /* Six touches and one release */
+    const esp_lcd_touch_virtual_sample_t *recorded = NULL;
+    size_t recorded_count = 0;
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_touch_virtual_get_trace(recorder, &recorded, &recorded_count));
+    TEST_ASSERT_EQUAL(7, recorded_count);
+    for (int i = 0; i < recorded_count; i++) {
+        TEST_ASSERT_EQUAL_UINT8((i < 6 ? 1 : 0), recorded[i].points);
+        if (i > 0) {
+            TEST_ASSERT_GREATER_THAN_UINT32(recorded[i - 1].time_us, recorded[i].time_us);
+        }
+    }
+
+    /* Saved trace is played the same */
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_touch_virtual_save_trace(TEST_TRACE_FILE, recorded, recorded_count));
+    const esp_lcd_touch_virtual_config_t play_cfg = {
+        .file_path = TEST_TRACE_FILE,
+    };
+    const esp_lcd_touch_config_t play_tp_cfg = {
+        .x_max = TEST_TOUCH_H_RES,
+        .y_max = TEST_TOUCH_V_RES,
+        .rst_gpio_num = GPIO_NUM_NC,
+        .int_gpio_num = GPIO_NUM_NC,
+        .driver_data = (void *) &play_cfg,
+    };
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_touch_new_virtual(&play_tp_cfg, &player));
+
+    const esp_lcd_touch_virtual_sample_t *played = NULL;
+    size_t played_count = 0;
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_touch_virtual_get_trace(player, &played, &played_count));
+    TEST_ASSERT_EQUAL(recorded_count, played_count);
+    for (int i = 0; i < played_count; i++) {
+        TEST_ASSERT_EQUAL_UINT32(recorded[i].time_us, played[i].time_us);
+        TEST_ASSERT_EQUAL_UINT8(recorded[i].points, played[i].points);
+        TEST_ASSERT_EQUAL_MEMORY(recorded[i].coords, played[i].coords, recorded[i].points * sizeof(recorded[i].coords[0]));
+    }
+
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_touch_del(player));
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_touch_del(recorder));
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_touch_del(gt911));
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_panel_io_del(io));
+    remove(TEST_TRACE_FILE);
+}
+
+TEST_CASE("Virtual touch trace file", "[touch][virtual]")
+{
+    esp_lcd_touch_handle_t tp = NULL;
+    const esp_lcd_touch_virtual_config_t virtual_cfg = {
+        .file_path = TEST_TRACE_FILE,
+    };
+    const esp_lcd_touch_config_t tp_cfg = {
+        .x_max = TEST_TOUCH_H_RES,
+        .y_max = TEST_TOUCH_V_RES,
+        .rst_gpio_num = GPIO_NUM_NC,
+        .int_gpio_num = GPIO_NUM_NC,
+        .driver_data = (void *) &virtual_cfg,
+    };
+
+    /* Trace written by hand, with comments and empty lines */
+    FILE *f = fopen(TEST_TRACE_FILE, "w");
+    TEST_ASSERT_NOT_NULL(f);
+    fprintf(f, "# Tap\n\n  5000 1 10 20 30\n");
+    fprintf(f, "15000 0\n");
+    fclose(f);
+
+    const esp_lcd_touch_virtual_sample_t *samples = NULL;
+    size_t samples_count = 0;
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_touch_new_virtual(&tp_cfg, &tp));
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_touch_virtual_get_trace(tp, &samples, &samples_count));
+    TEST_ASSERT_EQUAL(2, samples_count);
+    TEST_ASSERT_EQUAL_UINT32(5000, samples[0].time_us);
+    TEST_ASSERT_EQUAL_UINT8(1, samples[0].points);
+    TEST_ASSERT_EQUAL_UINT16(10, samples[0].coords[0].x);
+    TEST_ASSERT_EQUAL_UINT16(20, samples[0].coords[0].y);
+    TEST_ASSERT_EQUAL_UINT16(30, samples[0].coords[0].strength);
+    TEST_ASSERT_EQUAL_UINT32(15000, samples[1].time_us);
+    TEST_ASSERT_EQUAL_UINT8(0, samples[1].points);
+    TEST_ASSERT_EQUAL(ESP_OK, esp_lcd_touch_del(tp));
+
+    /* Missing coordinates and time going back */
+    const char *invalid[] = {"5000 1 10 20\n", "5000 0\n4000 0\n"};
+    for (int i = 0; i < sizeof(invalid) / sizeof(invalid[0]); i++) {
+        f = fopen(TEST_TRACE_FILE, "w");
+        TEST_ASSERT_NOT_NULL(f);
+        fputs(invalid[i], f);
+        fclose(f);
+        TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, esp_lcd_touch_new_virtual(&tp_cfg, &tp));
+    }
+
+    remove(TEST_TRACE_FILE);
+    TEST_ASSERT_EQUAL(ESP_ERR_NOT_FOUND, esp_lcd_touch_new_virtual(&tp_cfg, &tp));
+}
@@ -25,7 +25,6 @@
 static const char *TAG = "CST816S";
 
 static esp_err_t read_data(esp_lcd_touch_handle_t tp);
-static bool get_xy(esp_lcd_touch_handle_t tp, uint16_t *x, uint16_t *y, uint16_t *strength, uint8_t *point_num, uint8_t max_point_num);
 static esp_err_t del(esp_lcd_touch_handle_t tp);
 
 static esp_err_t i2c_read_bytes(esp_lcd_touch_handle_t tp, uint16_t reg, uint8_t *data, uint8_t len);
@@ -48,7 +47,7 @@ esp_err_t esp_lcd_touch_new_i2c_cst816s(const esp_lcd_panel_io_handle_t io, cons
     cst816s->io = io;
     /* Only supported callbacks are set */
     cst816s->read_data = read_data;
-    cst816s->get_xy = get_xy;
+    cst816s->get_xy = esp_lcd_touch_get_sample_xy;
     cst816s->del = del;
     /* Mutex */
     cst816s->data.lock.owner = portMUX_FREE_VAL;
@@ -107,39 +106,19 @@ static esp_err_t read_data(esp_lcd_touch_handle_t tp)
     data_t point;
     ESP_RETURN_ON_ERROR(i2c_read_bytes(tp, DATA_START_REG, (uint8_t *)&point, sizeof(data_t)), TAG, "I2C read failed");
 
-    portENTER_CRITICAL(&tp->data.lock);
+    esp_lcd_touch_sample_t sample = {0};
     point.num = (point.num > POINT_NUM_MAX ? POINT_NUM_MAX : point.num);
-    tp->data.points = point.num;
+    sample.points = point.num;
     /* Fill all coordinates */
     for (int i = 0; i < point.num; i++) {
-        tp->data.coords[i].x = point.x_h << 8 | point.x_l;
-        tp->data.coords[i].y = point.y_h << 8 | point.y_l;
+        sample.coords[i].x = point.x_h << 8 | point.x_l;
+        sample.coords[i].y = point.y_h << 8 | point.y_l;
     }
-    portEXIT_CRITICAL(&tp->data.lock);
+    esp_lcd_touch_publish_sample(tp, &sample);
 
     return ESP_OK;
 }
 
-static bool get_xy(esp_lcd_touch_handle_t tp, uint16_t *x, uint16_t *y, uint16_t *strength, uint8_t *point_num, uint8_t max_point_num)
-{
-    portENTER_CRITICAL(&tp->data.lock);
-    /* Count of points */
-    *point_num = (tp->data.points > max_point_num ? max_point_num : tp->data.points);
-    for (size_t i = 0; i < *point_num; i++) {
-        x[i] = tp->data.coords[i].x;
-        y[i] = tp->data.coords[i].y;
-
-        if (strength) {
-            strength[i] = tp->data.coords[i].strength;
-        }
-    }
-    /* Invalidate */
-    tp->data.points = 0;
-    portEXIT_CRITICAL(&tp->data.lock);
-
-    return (*point_num > 0);
-}
-
 static esp_err_t del(esp_lcd_touch_handle_t tp)
 {
     /* Reset GPIO pin settings */
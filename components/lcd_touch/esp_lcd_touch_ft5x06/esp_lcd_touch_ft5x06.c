@@ -53,6 +53,9 @@ static const char *TAG = "FT5x06";
 #define FT5x06_TOUCH5_YH        (0x1D)
 #define FT5x06_TOUCH5_YL        (0x1E)
 
+#define FT5x06_TOUCH_MAX_POINTS (5)
+#define FT5x06_TOUCH_POINT_LEN  (6)
+
 #define FT5x06_ID_G_THGROUP             (0x80)
 #define FT5x06_ID_G_THPEAK              (0x81)
 #define FT5x06_ID_G_THCAL               (0x82)
@@ -78,7 +81,6 @@ static const char *TAG = "FT5x06";
 * Function definitions
 *******************************************************************************/
 static esp_err_t esp_lcd_touch_ft5x06_read_data(esp_lcd_touch_handle_t tp);
-static bool esp_lcd_touch_ft5x06_get_xy(esp_lcd_touch_handle_t tp, uint16_t *x, uint16_t *y, uint16_t *strength, uint8_t *point_num, uint8_t max_point_num);
 static esp_err_t esp_lcd_touch_ft5x06_del(esp_lcd_touch_handle_t tp);
 
 /* I2C read */
@@ -110,7 +112,7 @@ esp_err_t esp_lcd_touch_new_i2c_ft5x06(const esp_lcd_panel_io_handle_t io, const
 
     /* Only supported callbacks are set */
     esp_lcd_touch_ft5x06->read_data = esp_lcd_touch_ft5x06_read_data;
-    esp_lcd_touch_ft5x06->get_xy = esp_lcd_touch_ft5x06_get_xy;
+    esp_lcd_touch_ft5x06->get_xy = esp_lcd_touch_get_sample_xy;
     esp_lcd_touch_ft5x06->del = esp_lcd_touch_ft5x06_del;
 
     /* Mutex */
@@ -169,71 +171,56 @@ err:
 static esp_err_t esp_lcd_touch_ft5x06_read_data(esp_lcd_touch_handle_t tp)
 {
     esp_err_t err;
-    uint8_t data[30];
+    esp_lcd_touch_sample_t last;
+    uint8_t data[1 + (FT5x06_TOUCH_POINT_LEN * FT5x06_TOUCH_MAX_POINTS)];
     uint8_t points;
+    uint8_t burst_cnt;
     size_t i = 0;
 
     assert(tp != NULL);
 
-    err = touch_ft5x06_i2c_read(tp, FT5x06_TOUCH_POINTS, &points, 1);
+    /* Count of points is read together with as many points as were reported last time, so a held touch needs one read only */
+    esp_lcd_touch_peek_sample(tp, &last);
+    burst_cnt = (last.points > FT5x06_TOUCH_MAX_POINTS ? FT5x06_TOUCH_MAX_POINTS : last.points);
+    err = touch_ft5x06_i2c_read(tp, FT5x06_TOUCH_POINTS, data, 1 + (FT5x06_TOUCH_POINT_LEN * burst_cnt));
     ESP_RETURN_ON_ERROR(err, TAG, "I2C read error!");
 
-    if (points > 5 || points == 0) {
+    points = data[0];
+    if (points > FT5x06_TOUCH_MAX_POINTS) {
+        return ESP_OK;
+    }
+
+    /* Release is published only once */
+    if (points == 0 && last.points == 0) {
         return ESP_OK;
     }
 
     /* Number of touched points */
     points = (points > CONFIG_ESP_LCD_TOUCH_MAX_POINTS ? CONFIG_ESP_LCD_TOUCH_MAX_POINTS : points);
 
-    err = touch_ft5x06_i2c_read(tp, FT5x06_TOUCH1_XH, data, 6 * points);
-    ESP_RETURN_ON_ERROR(err, TAG, "I2C read error!");
+    /* Read the points, which were not read together with the count */
+    if (points > burst_cnt) {
+        const size_t offset = FT5x06_TOUCH_POINT_LEN * burst_cnt;
+        err = touch_ft5x06_i2c_read(tp, FT5x06_TOUCH1_XH + offset, &data[1 + offset], FT5x06_TOUCH_POINT_LEN * (points - burst_cnt));
+        ESP_RETURN_ON_ERROR(err, TAG, "I2C read error!");
+    }
 
-    portENTER_CRITICAL(&tp->data.lock);
+    esp_lcd_touch_sample_t sample = {0};
 
     /* Number of touched points */
-    tp->data.points = points;
+    sample.points = points;
 
     /* Fill all coordinates */
     for (i = 0; i < points; i++) {
-        tp->data.coords[i].x = (((uint16_t)data[(i * 6) + 0] & 0x0f) << 8) + data[(i * 6) + 1];
-        tp->data.coords[i].y = (((uint16_t)data[(i * 6) + 2] & 0x0f) << 8) + data[(i * 6) + 3];
+        sample.coords[i].x = (((uint16_t)data[(i * 6) + 1] & 0x0f) << 8) + data[(i * 6) + 2];
+        sample.coords[i].y = (((uint16_t)data[(i * 6) + 3] & 0x0f) << 8) + data[(i * 6) + 4];
     }
 
-    portEXIT_CRITICAL(&tp->data.lock);
+    esp_lcd_touch_publish_sample(tp, &sample);
 
     return ESP_OK;
 }
 
-static bool esp_lcd_touch_ft5x06_get_xy(esp_lcd_touch_handle_t tp, uint16_t *x, uint16_t *y, uint16_t *strength, uint8_t *point_num, uint8_t max_point_num)
-{
-    assert(tp != NULL);
-    assert(x != NULL);
-    assert(y != NULL);
-    assert(point_num != NULL);
-    assert(max_point_num > 0);
-
-    portENTER_CRITICAL(&tp->data.lock);
-
-    /* Count of points */
-    *point_num = (tp->data.points > max_point_num ? max_point_num : tp->data.points);
-
-    for (size_t i = 0; i < *point_num; i++) {
-        x[i] = tp->data.coords[i].x;
-        y[i] = tp->data.coords[i].y;
-
-        if (strength) {
-            strength[i] = tp->data.coords[i].strength;
-        }
-    }
-
-    /* Invalidate */
-    tp->data.points = 0;
-
-    portEXIT_CRITICAL(&tp->data.lock);
-
-    return (*point_num > 0);
-}
-
 static esp_err_t esp_lcd_touch_ft5x06_del(esp_lcd_touch_handle_t tp)
 {
     assert(tp != NULL);
@@ -29,7 +29,6 @@ static const char *TAG = "gt1151";
 #define IS_NUM_OR_CHAR(x)           (((x) >= 'A' && (x) <= 'Z') || ((x) >= '0' && (x) <= '9'))
 
 static esp_err_t read_data(esp_lcd_touch_handle_t tp);
-static bool get_xy(esp_lcd_touch_handle_t tp, uint16_t *x, uint16_t *y, uint16_t *strength, uint8_t *point_num, uint8_t max_point_num);
 static esp_err_t del(esp_lcd_touch_handle_t tp);
 
 static esp_err_t i2c_read_bytes(esp_lcd_touch_handle_t tp, uint16_t reg, uint8_t *data, uint8_t len);
@@ -53,7 +52,7 @@ esp_err_t esp_lcd_touch_new_i2c_gt1151(const esp_lcd_panel_io_handle_t io, const
     gt1151->io = io;
     /* Only supported callbacks are set */
     gt1151->read_data = read_data;
-    gt1151->get_xy = get_xy;
+    gt1151->get_xy = esp_lcd_touch_get_sample_xy;
     gt1151->del = del;
     /* Mutex */
     gt1151->data.lock.owner = portMUX_FREE_VAL;
@@ -114,20 +113,35 @@ static esp_err_t read_data(esp_lcd_touch_handle_t tp)
         touch_record_t touch_record[0];
     } __attribute__((packed)) touch_report_t;
 
-    uint8_t touch_cnt;
-    ESP_RETURN_ON_ERROR(i2c_read_bytes(tp, READ_XY_REG, &touch_cnt, sizeof(touch_cnt)), TAG, "I2C read failed!");
-    touch_cnt &= 0x0f;
-    /* Any touch data? */
+    esp_lcd_touch_sample_t last;
+    uint8_t buf[DATA_BUFF_LEN(MAX_TOUCH_NUM)];
+    /* Status is read together with as many points as were reported last time, so a held touch needs one read only */
+    esp_lcd_touch_peek_sample(tp, &last);
+    const uint8_t last_cnt = (last.points > MAX_TOUCH_NUM ? MAX_TOUCH_NUM : last.points);
+    const uint8_t read_len = (last_cnt > 0 ? DATA_BUFF_LEN(last_cnt) : 1);
+    ESP_RETURN_ON_ERROR(i2c_read_bytes(tp, READ_XY_REG, buf, read_len), TAG, "I2C read failed!");
+    /* Any touch data? Nothing to clear, when the controller has not reported anything */
+    if ((buf[0] & 0x80) == 0) {
+        return ESP_OK;
+    }
+    uint8_t touch_cnt = buf[0] & 0x0f;
     if (touch_cnt > MAX_TOUCH_NUM || touch_cnt == 0) {
-        i2c_write_byte(tp, READ_XY_REG, 0);
+        ESP_RETURN_ON_ERROR(i2c_write_byte(tp, READ_XY_REG, 0), TAG, "I2C write failed");
+        /* Release is published only once */
+        if (touch_cnt == 0 && last.points > 0) {
+            const esp_lcd_touch_sample_t release = {0};
+            esp_lcd_touch_publish_sample(tp, &release);
+        }
         return ESP_OK;
     }
 
-    uint8_t buf[DATA_BUFF_LEN(MAX_TOUCH_NUM)];
-    /* Read all points */
-    ESP_RETURN_ON_ERROR( i2c_read_bytes(tp, READ_XY_REG, buf, DATA_BUFF_LEN(touch_cnt)), TAG, "I2C read failed");
+    /* Read the points, which were not read together with the status */
+    if (DATA_BUFF_LEN(touch_cnt) > read_len) {
+        ESP_RETURN_ON_ERROR(i2c_read_bytes(tp, READ_XY_REG + read_len, &buf[read_len], DATA_BUFF_LEN(touch_cnt) - read_len),
+                            TAG, "I2C read failed");
+    }
     /* Clear all */
-    i2c_write_byte(tp, READ_XY_REG, 0);
+    ESP_RETURN_ON_ERROR(i2c_write_byte(tp, READ_XY_REG, 0), TAG, "I2C write failed");
     /* Caculate checksum */
     uint8_t checksum = 0;
     for (int i = 0; i < DATA_BUFF_LEN(touch_cnt); i++) {
@@ -136,42 +150,22 @@ static esp_err_t read_data(esp_lcd_touch_handle_t tp)
     ESP_RETURN_ON_FALSE(!checksum, ESP_ERR_INVALID_CRC, TAG, "Checksum error");
 
     touch_report_t *touch_report = (touch_report_t *)buf;
-    portENTER_CRITICAL(&tp->data.lock);
+    esp_lcd_touch_sample_t sample = {0};
     /* Expect Number of touched points */
     touch_cnt = (touch_cnt > CONFIG_ESP_LCD_TOUCH_MAX_POINTS ? CONFIG_ESP_LCD_TOUCH_MAX_POINTS : touch_cnt);
-    tp->data.points = touch_cnt;
+    sample.points = touch_cnt;
 
     /* Fill all coordinates */
     for (int i = 0; i < touch_cnt; i++) {
-        tp->data.coords[i].x = touch_report->touch_record[i].x;
-        tp->data.coords[i].y = touch_report->touch_record[i].y;
-        tp->data.coords[i].strength = touch_report->touch_record[i].strength;
+        sample.coords[i].x = touch_report->touch_record[i].x;
+        sample.coords[i].y = touch_report->touch_record[i].y;
+        sample.coords[i].strength = touch_report->touch_record[i].strength;
     }
-    portEXIT_CRITICAL(&tp->data.lock);
+    esp_lcd_touch_publish_sample(tp, &sample);
 
     return ESP_OK;
 }
 
-static bool get_xy(esp_lcd_touch_handle_t tp, uint16_t *x, uint16_t *y, uint16_t *strength, uint8_t *point_num, uint8_t max_point_num)
-{
-    portENTER_CRITICAL(&tp->data.lock);
-    /* Count of points */
-    *point_num = (tp->data.points > max_point_num ? max_point_num : tp->data.points);
-    for (size_t i = 0; i < *point_num; i++) {
-        x[i] = tp->data.coords[i].x;
-        y[i] = tp->data.coords[i].y;
-
-        if (strength) {
-            strength[i] = tp->data.coords[i].strength;
-        }
-    }
-    /* Invalidate */
-    tp->data.points = 0;
-    portEXIT_CRITICAL(&tp->data.lock);
-
-    return (*point_num > 0);
-}
-
 static esp_err_t del(esp_lcd_touch_handle_t tp)
 {
     /* Reset GPIO pin settings */
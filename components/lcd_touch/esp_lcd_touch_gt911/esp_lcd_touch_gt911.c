@@ -29,11 +29,14 @@ static const char *TAG = "GT911";
 /* GT911 support key num */
 #define ESP_GT911_TOUCH_MAX_BUTTONS         (4)
 
+/* GT911 support touch points and length of one point in the report */
+#define ESP_GT911_TOUCH_MAX_POINTS          (5)
+#define ESP_GT911_TOUCH_POINT_LEN           (8)
+
 /*******************************************************************************
 * Function definitions
 *******************************************************************************/
 static esp_err_t esp_lcd_touch_gt911_read_data(esp_lcd_touch_handle_t tp);
-static bool esp_lcd_touch_gt911_get_xy(esp_lcd_touch_handle_t tp, uint16_t *x, uint16_t *y, uint16_t *strength, uint8_t *point_num, uint8_t max_point_num);
 #if (CONFIG_ESP_LCD_TOUCH_MAX_BUTTONS > 0)
 static esp_err_t esp_lcd_touch_gt911_get_button_state(esp_lcd_touch_handle_t tp, uint8_t n, uint8_t *state);
 #endif
@@ -73,7 +76,7 @@ esp_err_t esp_lcd_touch_new_i2c_gt911(const esp_lcd_panel_io_handle_t io, const
 
     /* Only supported callbacks are set */
     esp_lcd_touch_gt911->read_data = esp_lcd_touch_gt911_read_data;
-    esp_lcd_touch_gt911->get_xy = esp_lcd_touch_gt911_get_xy;
+    esp_lcd_touch_gt911->get_xy = esp_lcd_touch_get_sample_xy;
 #if (CONFIG_ESP_LCD_TOUCH_MAX_BUTTONS > 0)
     esp_lcd_touch_gt911->get_button_state = esp_lcd_touch_gt911_get_button_state;
 #endif
@@ -209,19 +212,24 @@ static esp_err_t esp_lcd_touch_gt911_exit_sleep(esp_lcd_touch_handle_t tp)
 static esp_err_t esp_lcd_touch_gt911_read_data(esp_lcd_touch_handle_t tp)
 {
     esp_err_t err;
-    uint8_t buf[41];
+    esp_lcd_touch_sample_t last;
+    uint8_t buf[1 + (ESP_GT911_TOUCH_POINT_LEN * ESP_GT911_TOUCH_MAX_POINTS)];
     uint8_t touch_cnt = 0;
+    uint8_t burst_cnt = 0;
     uint8_t clear = 0;
     size_t i = 0;
 
     assert(tp != NULL);
 
-    err = touch_gt911_i2c_read(tp, ESP_LCD_TOUCH_GT911_READ_XY_REG, buf, 1);
+    /* Status is read together with as many points as were reported last time, so a held touch needs one read only */
+    esp_lcd_touch_peek_sample(tp, &last);
+    burst_cnt = (last.points > ESP_GT911_TOUCH_MAX_POINTS ? ESP_GT911_TOUCH_MAX_POINTS : last.points);
+    err = touch_gt911_i2c_read(tp, ESP_LCD_TOUCH_GT911_READ_XY_REG, buf, 1 + (burst_cnt * ESP_GT911_TOUCH_POINT_LEN));
     ESP_RETURN_ON_ERROR(err, TAG, "I2C read error!");
 
-    /* Any touch data? */
+    /* Any touch data? Nothing to clear, when the controller has not reported anything */
     if ((buf[0] & 0x80) == 0x00) {
-        touch_gt911_i2c_write(tp, ESP_LCD_TOUCH_GT911_READ_XY_REG, clear);
+        return ESP_OK;
 #if (CONFIG_ESP_LCD_TOUCH_MAX_BUTTONS > 0)
     } else if ((buf[0] & 0x10) == 0x10) {
         /* Read all keys */
@@ -231,7 +239,7 @@ static esp_err_t esp_lcd_touch_gt911_read_data(esp_lcd_touch_handle_t tp)
         ESP_RETURN_ON_ERROR(err, TAG, "I2C read error!");
 
         /* Clear all */
-        touch_gt911_i2c_write(tp, ESP_LCD_TOUCH_GT911_READ_XY_REG, clear);
+        err = touch_gt911_i2c_write(tp, ESP_LCD_TOUCH_GT911_READ_XY_REG, clear);
         ESP_RETURN_ON_ERROR(err, TAG, "I2C write error!");
 
         portENTER_CRITICAL(&tp->data.lock);
@@ -254,68 +262,47 @@ static esp_err_t esp_lcd_touch_gt911_read_data(esp_lcd_touch_handle_t tp)
 #endif
         /* Count of touched points */
         touch_cnt = buf[0] & 0x0f;
-        if (touch_cnt > 5 || touch_cnt == 0) {
+        if (touch_cnt > ESP_GT911_TOUCH_MAX_POINTS) {
             touch_gt911_i2c_write(tp, ESP_LCD_TOUCH_GT911_READ_XY_REG, clear);
             return ESP_OK;
         }
 
-        /* Read all points */
-        err = touch_gt911_i2c_read(tp, ESP_LCD_TOUCH_GT911_READ_XY_REG + 1, &buf[1], touch_cnt * 8);
-        ESP_RETURN_ON_ERROR(err, TAG, "I2C read error!");
+        /* Read the points, which were not read together with the status */
+        if (touch_cnt > burst_cnt) {
+            const size_t offset = 1 + (burst_cnt * ESP_GT911_TOUCH_POINT_LEN);
+            err = touch_gt911_i2c_read(tp, ESP_LCD_TOUCH_GT911_READ_XY_REG + offset, &buf[offset],
+                                       (touch_cnt - burst_cnt) * ESP_GT911_TOUCH_POINT_LEN);
+            ESP_RETURN_ON_ERROR(err, TAG, "I2C read error!");
+        }
 
         /* Clear all */
         err = touch_gt911_i2c_write(tp, ESP_LCD_TOUCH_GT911_READ_XY_REG, clear);
-        ESP_RETURN_ON_ERROR(err, TAG, "I2C read error!");
+        ESP_RETURN_ON_ERROR(err, TAG, "I2C write error!");
 
-        portENTER_CRITICAL(&tp->data.lock);
+        /* Release is published only once */
+        if (touch_cnt == 0 && last.points == 0) {
+            return ESP_OK;
+        }
+
+        esp_lcd_touch_sample_t sample = {0};
 
         /* Number of touched points */
         touch_cnt = (touch_cnt > CONFIG_ESP_LCD_TOUCH_MAX_POINTS ? CONFIG_ESP_LCD_TOUCH_MAX_POINTS : touch_cnt);
-        tp->data.points = touch_cnt;
+        sample.points = touch_cnt;
 
         /* Fill all coordinates */
         for (i = 0; i < touch_cnt; i++) {
-            tp->data.coords[i].x = ((uint16_t)buf[(i * 8) + 3] << 8) + buf[(i * 8) + 2];
-            tp->data.coords[i].y = (((uint16_t)buf[(i * 8) + 5] << 8) + buf[(i * 8) + 4]);
-            tp->data.coords[i].strength = (((uint16_t)buf[(i * 8) + 7] << 8) + buf[(i * 8) + 6]);
+            sample.coords[i].x = ((uint16_t)buf[(i * 8) + 3] << 8) + buf[(i * 8) + 2];
+            sample.coords[i].y = (((uint16_t)buf[(i * 8) + 5] << 8) + buf[(i * 8) + 4]);
+            sample.coords[i].strength = (((uint16_t)buf[(i * 8) + 7] << 8) + buf[(i * 8) + 6]);
         }
 
-        portEXIT_CRITICAL(&tp->data.lock);
+        esp_lcd_touch_publish_sample(tp, &sample);
     }
 
     return ESP_OK;
 }
 
-static bool esp_lcd_touch_gt911_get_xy(esp_lcd_touch_handle_t tp, uint16_t *x, uint16_t *y, uint16_t *strength, uint8_t *point_num, uint8_t max_point_num)
-{
-    assert(tp != NULL);
-    assert(x != NULL);
-    assert(y != NULL);
-    assert(point_num != NULL);
-    assert(max_point_num > 0);
-
-    portENTER_CRITICAL(&tp->data.lock);
-
-    /* Count of points */
-    *point_num = (tp->data.points > max_point_num ? max_point_num : tp->data.points);
-
-    for (size_t i = 0; i < *point_num; i++) {
-        x[i] = tp->data.coords[i].x;
-        y[i] = tp->data.coords[i].y;
-
-        if (strength) {
-            strength[i] = tp->data.coords[i].strength;
-        }
-    }
-
-    /* Invalidate */
-    tp->data.points = 0;
-
-    portEXIT_CRITICAL(&tp->data.lock);
-
-    return (*point_num > 0);
-}
-
 #if (CONFIG_ESP_LCD_TOUCH_MAX_BUTTONS > 0)
 static esp_err_t esp_lcd_touch_gt911_get_button_state(esp_lcd_touch_handle_t tp, uint8_t n, uint8_t *state)
 {
@@ -65,7 +65,6 @@ static const char *TAG = "STMPE610";
 * Function definitions
 *******************************************************************************/
 static esp_err_t esp_lcd_touch_stmpe610_read_data(esp_lcd_touch_handle_t tp);
-static bool esp_lcd_touch_stmpe610_get_xy(esp_lcd_touch_handle_t tp, uint16_t *x, uint16_t *y, uint16_t *strength, uint8_t *point_num, uint8_t max_point_num);
 static esp_err_t esp_lcd_touch_stmpe610_del(esp_lcd_touch_handle_t tp);
 
 /* I2C read/write */
@@ -100,7 +99,7 @@ esp_err_t esp_lcd_touch_new_spi_stmpe610(const esp_lcd_panel_io_handle_t io, con
 
     /* Only supported callbacks are set */
     esp_lcd_touch_stmpe610->read_data = esp_lcd_touch_stmpe610_read_data;
-    esp_lcd_touch_stmpe610->get_xy = esp_lcd_touch_stmpe610_get_xy;
+    esp_lcd_touch_stmpe610->get_xy = esp_lcd_touch_get_sample_xy;
     esp_lcd_touch_stmpe610->del = esp_lcd_touch_stmpe610_del;
 
     /* Mutex */
@@ -199,46 +198,16 @@ static esp_err_t esp_lcd_touch_stmpe610_read_data(esp_lcd_touch_handle_t tp)
     /* Reset all ints */
     ESP_RETURN_ON_ERROR(touch_stmpe610_write(tp, ESP_LCD_TOUCH_STMPE610_REG_INT_STA, 0xFF), TAG, "STMPE610 write error!");
 
-    portENTER_CRITICAL(&tp->data.lock);
-    tp->data.coords[0].x = data_convert(x / cnt, 150, 3800, 0, tp->config.x_max);
-    tp->data.coords[0].y = data_convert(y / cnt, 150, 3800, 0, tp->config.y_max);
-    tp->data.coords[0].strength = z / cnt;
-    tp->data.points = 1;
-    portEXIT_CRITICAL(&tp->data.lock);
+    esp_lcd_touch_sample_t sample = {0};
+    sample.coords[0].x = data_convert(x / cnt, 150, 3800, 0, tp->config.x_max);
+    sample.coords[0].y = data_convert(y / cnt, 150, 3800, 0, tp->config.y_max);
+    sample.coords[0].strength = z / cnt;
+    sample.points = 1;
+    esp_lcd_touch_publish_sample(tp, &sample);
 
     return ESP_OK;
 }
 
-static bool esp_lcd_touch_stmpe610_get_xy(esp_lcd_touch_handle_t tp, uint16_t *x, uint16_t *y, uint16_t *strength, uint8_t *point_num, uint8_t max_point_num)
-{
-    assert(tp != NULL);
-    assert(x != NULL);
-    assert(y != NULL);
-    assert(point_num != NULL);
-    assert(max_point_num > 0);
-
-    portENTER_CRITICAL(&tp->data.lock);
-
-    /* Count of points */
-    *point_num = (tp->data.points > max_point_num ? max_point_num : tp->data.points);
-
-    for (size_t i = 0; i < *point_num; i++) {
-        x[i] = tp->data.coords[i].x;
-        y[i] = tp->data.coords[i].y;
-
-        if (strength) {
-            strength[i] = tp->data.coords[i].strength;
-        }
-    }
-
-    /* Invalidate */
-    tp->data.points = 0;
-
-    portEXIT_CRITICAL(&tp->data.lock);
-
-    return (*point_num > 0);
-}
-
 static esp_err_t esp_lcd_touch_stmpe610_del(esp_lcd_touch_handle_t tp)
 {
     assert(tp != NULL);
@@ -23,7 +23,6 @@ static const char *TAG = "TT21100";
 * Function definitions
 *******************************************************************************/
 static esp_err_t esp_lcd_touch_tt21100_read_data(esp_lcd_touch_handle_t tp);
-static bool esp_lcd_touch_tt21100_get_xy(esp_lcd_touch_handle_t tp, uint16_t *x, uint16_t *y, uint16_t *strength, uint8_t *point_num, uint8_t max_point_num);
 #if (CONFIG_ESP_LCD_TOUCH_MAX_BUTTONS > 0)
 static esp_err_t esp_lcd_touch_tt21100_get_button_state(esp_lcd_touch_handle_t tp, uint8_t n, uint8_t *state);
 #endif
@@ -61,7 +60,7 @@ esp_err_t esp_lcd_touch_new_i2c_tt21100(const esp_lcd_panel_io_handle_t io, cons
 
     /* Only supported callbacks are set */
     esp_lcd_touch_tt21100->read_data = esp_lcd_touch_tt21100_read_data;
-    esp_lcd_touch_tt21100->get_xy = esp_lcd_touch_tt21100_get_xy;
+    esp_lcd_touch_tt21100->get_xy = esp_lcd_touch_get_sample_xy;
 #if (CONFIG_ESP_LCD_TOUCH_MAX_BUTTONS > 0)
     esp_lcd_touch_tt21100->get_button_state = esp_lcd_touch_tt21100_get_button_state;
 #endif
@@ -201,13 +200,13 @@ static esp_err_t esp_lcd_touch_tt21100_read_data(esp_lcd_touch_handle_t tp)
         touch_tt21100_i2c_read(tp, data, data_len);
         ESP_RETURN_ON_ERROR(err, TAG, "I2C read error!");
 
-        portENTER_CRITICAL(&tp->data.lock);
-
         if (data_len == 14) {
 #if (CONFIG_ESP_LCD_TOUCH_MAX_BUTTONS > 0)
             /* Button event */
             p_btn_data = (button_record_struct_t *) data;
 
+            portENTER_CRITICAL(&tp->data.lock);
+
             /* Buttons count */
             tp->data.buttons = (CONFIG_ESP_LCD_TOUCH_MAX_BUTTONS < 4 ? CONFIG_ESP_LCD_TOUCH_MAX_BUTTONS : 4);
 
@@ -215,65 +214,39 @@ static esp_err_t esp_lcd_touch_tt21100_read_data(esp_lcd_touch_handle_t tp)
                 tp->data.button[i].status = p_btn_data->btn_signal[i];
             }
 
+            portEXIT_CRITICAL(&tp->data.lock);
+
             ESP_LOGD(TAG, "Len : %04Xh. ID : %02Xh. Time : %5u. Val : [%u] - [%04X][%04X][%04X][%04X]",
                      p_btn_data->length, p_btn_data->report_id, p_btn_data->time_stamp, p_btn_data->btn_val,
                      p_btn_data->btn_signal[0], p_btn_data->btn_signal[1], p_btn_data->btn_signal[2], p_btn_data->btn_signal[3]);
 #endif
         } else if (data_len >= 7) {
+            esp_lcd_touch_sample_t sample = {0};
+
             /* Touch point event */
             p_report_data = (touch_report_struct_t *) data;
             tp_num = (data_len - sizeof(touch_report_struct_t)) / sizeof(touch_record_struct_t);
 
             /* Number of touched points */
             tp_num = (tp_num > CONFIG_ESP_LCD_TOUCH_MAX_POINTS ? CONFIG_ESP_LCD_TOUCH_MAX_POINTS : tp_num);
-            tp->data.points = tp_num;
+            sample.points = tp_num;
 
             /* Fill all coordinates */
             for (i = 0; i < tp_num; i++) {
                 p_touch_data = &p_report_data->touch_record[i];
 
-                tp->data.coords[i].x = p_touch_data->x;
-                tp->data.coords[i].y = p_touch_data->y;
-                tp->data.coords[i].strength = p_touch_data->pressure;
+                sample.coords[i].x = p_touch_data->x;
+                sample.coords[i].y = p_touch_data->y;
+                sample.coords[i].strength = p_touch_data->pressure;
 
                 ESP_LOGD(TAG, "(%zu) [%3u][%3u]", i, p_touch_data->x, p_touch_data->y);
             }
-        }
 
-        portEXIT_CRITICAL(&tp->data.lock);
-    }
-
-    return ESP_OK;
-}
-
-static bool esp_lcd_touch_tt21100_get_xy(esp_lcd_touch_handle_t tp, uint16_t *x, uint16_t *y, uint16_t *strength, uint8_t *point_num, uint8_t max_point_num)
-{
-    assert(tp != NULL);
-    assert(x != NULL);
-    assert(y != NULL);
-    assert(point_num != NULL);
-    assert(max_point_num > 0);
-
-    portENTER_CRITICAL(&tp->data.lock);
-
-    /* Count of points */
-    *point_num = (tp->data.points > max_point_num ? max_point_num : tp->data.points);
-
-    for (size_t i = 0; i < *point_num; i++) {
-        x[i] = tp->data.coords[i].x;
-        y[i] = tp->data.coords[i].y;
-
-        if (strength) {
-            strength[i] = tp->data.coords[i].strength;
+            esp_lcd_touch_publish_sample(tp, &sample);
         }
     }
 
-    /* Invalidate */
-    tp->data.points = 0;
-
-    portEXIT_CRITICAL(&tp->data.lock);
-
-    return (*point_num > 0);
+    return ESP_OK;
 }
 
 #if (CONFIG_ESP_LCD_TOUCH_MAX_BUTTONS > 0)
@@ -0,0 +1,465 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <ctype.h>
+#include <inttypes.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "driver/gpio.h"
+#include "esp_err.h"
+#include "esp_log.h"
+#include "esp_check.h"
+#include "esp_timer.h"
+#include "esp_lcd_touch.h"
+#include "esp_lcd_touch_virtual.h"
+
+static const char *TAG = "virtual_touch";
+
+#define VIRTUAL_TRACE_LINE_LEN      (256)
+#define VIRTUAL_TRACE_GROW          (64)    /* Samples added to the trace loaded from file, when it is full */
+/* Numbers on one line of the trace file: time, points and x, y, strength of each point */
+#define VIRTUAL_TRACE_VALUES        (2 + 3 * CONFIG_ESP_LCD_TOUCH_MAX_POINTS)
+
+#define VIRTUAL_TOUCH(tp)           ((virtual_touch_t *)((char *)(tp) - offsetof(virtual_touch_t, base)))
+
+typedef struct {
+    esp_lcd_touch_t base;
+    esp_lcd_touch_handle_t source;                  /* Recorded touch (NULL = playback mode) */
+    const esp_lcd_touch_virtual_sample_t *samples;  /* Played or recorded trace */
+    esp_lcd_touch_virtual_sample_t *samples_alloc;  /* Trace owned by the driver (loaded from file or recorded) */
+    size_t samples_count;
+    size_t samples_max;                             /* Record: size of the trace buffer */
+    bool loop;
+    esp_timer_handle_t timer;
+    /* Playback state, written by the timer and read by the task reading the touch */
+    portMUX_TYPE lock;
+    bool running;
+    int64_t first_start_us;                         /* Start of the trace */
+    int64_t start_us;                               /* Start of the current loop of the trace */
+    size_t next;                                    /* Next sample, which is not due yet */
+    size_t due;                                     /* Last due sample */
+    int64_t due_time_us;                            /* Time of the last due sample */
+    uint32_t due_seq;                               /* Incremented by each due sample */
+    uint32_t reported;
+    uint32_t loops;
+    /* Owned by the task reading the touch */
+    uint32_t read_seq;                              /* Playback: due_seq of the last published sample */
+    int held;                                       /* Playback: pressed sample reported by every read (-1 = released) */
+    uint32_t source_seq;                            /* Record: sequence number of the last recorded sample */
+} virtual_touch_t;
+
+static esp_err_t read_data(esp_lcd_touch_handle_t tp);
+static esp_err_t del(esp_lcd_touch_handle_t tp);
+
+static void virtual_timer_cb(void *arg);
+static esp_err_t virtual_load_trace(virtual_touch_t *vt, const char *file_path);
+static esp_err_t virtual_check_trace(virtual_touch_t *vt);
+
+esp_err_t esp_lcd_touch_new_virtual(const esp_lcd_touch_config_t *config, esp_lcd_touch_handle_t *out_touch)
+{
+    ESP_RETURN_ON_FALSE(config, ESP_ERR_INVALID_ARG, TAG, "Invalid config");
+    ESP_RETURN_ON_FALSE(config->driver_data, ESP_ERR_INVALID_ARG, TAG, "Invalid virtual touch config");
+    ESP_RETURN_ON_FALSE(out_touch, ESP_ERR_INVALID_ARG, TAG, "Invalid touch handle");
+
+    const esp_lcd_touch_virtual_config_t *virtual_config = (const esp_lcd_touch_virtual_config_t *)config->driver_data;
+    ESP_RETURN_ON_FALSE(virtual_config->source || virtual_config->samples || virtual_config->file_path, ESP_ERR_INVALID_ARG,
+                        TAG, "Trace or source touch must be set");
+    ESP_RETURN_ON_FALSE(!virtual_config->source || virtual_config->samples_count > 0, ESP_ERR_INVALID_ARG,
+                        TAG, "Size of the recorded trace must be set");
+
+    /* Prepare main structure */
+    esp_err_t ret = ESP_OK;
+    virtual_touch_t *vt = calloc(1, sizeof(virtual_touch_t));
+    ESP_GOTO_ON_FALSE(vt, ESP_ERR_NO_MEM, err, TAG, "Touch handle malloc failed");
+    esp_lcd_touch_handle_t tp = &vt->base;
+
+    /* Only supported callbacks are set */
+    tp->read_data = read_data;
+    tp->get_xy = esp_lcd_touch_get_sample_xy;
+    tp->del = del;
+    /* Mutex */
+    tp->data.lock.owner = portMUX_FREE_VAL;
+    portMUX_INITIALIZE(&vt->lock);
+    vt->held = -1;
+
+    if (virtual_config->source) {
+        /* Record: the virtual touch replaces the source one, the samples are already filtered by the source */
+        vt->source = virtual_config->source;
+        memcpy(&tp->config, &vt->source->config, sizeof(esp_lcd_touch_config_t));
+        memset(&tp->config.filter, 0, sizeof(tp->config.filter));
+        tp->config.interrupt_callback = NULL;
+        tp->config.user_data = NULL;
+
+        vt->samples_alloc = calloc(virtual_config->samples_count, sizeof(esp_lcd_touch_virtual_sample_t));
+        ESP_GOTO_ON_FALSE(vt->samples_alloc, ESP_ERR_NO_MEM, err, TAG, "Trace malloc failed");
+        vt->samples = vt->samples_alloc;
+        vt->samples_max = virtual_config->samples_count;
+        vt->first_start_us = esp_timer_get_time();
+
+        /* Register interrupt callback, the source configured the pin */
+        if (tp->config.int_gpio_num != GPIO_NUM_NC && config->interrupt_callback) {
+            ESP_GOTO_ON_ERROR(esp_lcd_touch_register_interrupt_callback(tp, config->interrupt_callback), err, TAG,
+                              "Register interrupt callback failed");
+        }
+    } else {
+        /* Playback */
+        memcpy(&tp->config, config, sizeof(esp_lcd_touch_config_t));
+        if (virtual_config->samples) {
+            vt->samples = virtual_config->samples;
+            vt->samples_count = virtual_config->samples_count;
+        } else {
+            ESP_GOTO_ON_ERROR(virtual_load_trace(vt, virtual_config->file_path), err, TAG, "Load trace failed");
+        }
+        vt->loop = virtual_config->flags.loop;
+        ESP_GOTO_ON_ERROR(virtual_check_trace(vt), err, TAG, "Invalid trace");
+
+        const esp_timer_create_args_t timer_args = {
+            .callback = virtual_timer_cb,
+            .arg = vt,
+            .dispatch_method = ESP_TIMER_TASK,
+            .name = "virtual_touch",
+        };
+        ESP_GOTO_ON_ERROR(esp_timer_create(&timer_args, &vt->timer), err, TAG, "Create timer failed");
+
+        /* Prepare pin for touch interrupt, the pin is changed by the driver and read by the GPIO interrupt */
+        if (tp->config.int_gpio_num != GPIO_NUM_NC) {
+            const gpio_config_t int_gpio_config = {
+                .mode = GPIO_MODE_INPUT_OUTPUT,
+                .intr_type = (tp->config.levels.interrupt ? GPIO_INTR_POSEDGE : GPIO_INTR_NEGEDGE),
+                .pin_bit_mask = BIT64(tp->config.int_gpio_num)
+            };
+            ESP_GOTO_ON_ERROR(gpio_config(&int_gpio_config), err, TAG, "GPIO intr config failed");
+            ESP_GOTO_ON_ERROR(gpio_set_level(tp->config.int_gpio_num, !tp->config.levels.interrupt), err, TAG,
+                              "GPIO set level failed");
+
+            /* Register interrupt callback */
+            if (tp->config.interrupt_callback) {
+                esp_lcd_touch_register_interrupt_callback(tp, tp->config.interrupt_callback);
+            }
+        }
+    }
+    *out_touch = tp;
+
+    return ESP_OK;
+err:
+    if (vt) {
+        del(&vt->base);
+    }
+    ESP_LOGE(TAG, "Initialization failed!");
+    return ret;
+}
+
+esp_err_t esp_lcd_touch_virtual_start(esp_lcd_touch_handle_t tp)
+{
+    ESP_RETURN_ON_FALSE(tp && tp->read_data == read_data, ESP_ERR_INVALID_ARG, TAG, "Invalid virtual touch");
+    virtual_touch_t *vt = VIRTUAL_TOUCH(tp);
+    ESP_RETURN_ON_FALSE(!vt->source, ESP_ERR_NOT_SUPPORTED, TAG, "Touch is recording");
+
+    esp_lcd_touch_virtual_stop(tp);
+
+    portENTER_CRITICAL(&vt->lock);
+    vt->running = true;
+    vt->first_start_us = esp_timer_get_time();
+    vt->start_us = vt->first_start_us;
+    vt->next = 0;
+    vt->reported = 0;
+    vt->loops = 0;
+    portEXIT_CRITICAL(&vt->lock);
+
+    /* Samples at the start of the trace are reported now, the timer is started for the next ones */
+    virtual_timer_cb(vt);
+
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_touch_virtual_stop(esp_lcd_touch_handle_t tp)
+{
+    ESP_RETURN_ON_FALSE(tp && tp->read_data == read_data, ESP_ERR_INVALID_ARG, TAG, "Invalid virtual touch");
+    virtual_touch_t *vt = VIRTUAL_TOUCH(tp);
+    ESP_RETURN_ON_FALSE(!vt->source, ESP_ERR_NOT_SUPPORTED, TAG, "Touch is recording");
+
+    /* Timer started by the running callback expires without any effect */
+    portENTER_CRITICAL(&vt->lock);
+    vt->running = false;
+    portEXIT_CRITICAL(&vt->lock);
+    esp_timer_stop(vt->timer);
+
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_touch_virtual_get_status(esp_lcd_touch_handle_t tp, esp_lcd_touch_virtual_status_t *status)
+{
+    ESP_RETURN_ON_FALSE(tp && tp->read_data == read_data, ESP_ERR_INVALID_ARG, TAG, "Invalid virtual touch");
+    ESP_RETURN_ON_FALSE(status, ESP_ERR_INVALID_ARG, TAG, "Invalid status");
+    virtual_touch_t *vt = VIRTUAL_TOUCH(tp);
+
+    portENTER_CRITICAL(&vt->lock);
+    status->running = vt->running;
+    status->start_us = vt->first_start_us;
+    status->reported = (vt->source ? vt->samples_count : vt->reported);
+    status->loops = vt->loops;
+    portEXIT_CRITICAL(&vt->lock);
+
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_touch_virtual_get_trace(esp_lcd_touch_handle_t tp, const esp_lcd_touch_virtual_sample_t **samples, size_t *samples_count)
+{
+    ESP_RETURN_ON_FALSE(tp && tp->read_data == read_data, ESP_ERR_INVALID_ARG, TAG, "Invalid virtual touch");
+    ESP_RETURN_ON_FALSE(samples && samples_count, ESP_ERR_INVALID_ARG, TAG, "Invalid argument");
+    virtual_touch_t *vt = VIRTUAL_TOUCH(tp);
+
+    *samples = vt->samples;
+    *samples_count = vt->samples_count;
+
+    return ESP_OK;
+}
+
+esp_err_t esp_lcd_touch_virtual_save_trace(const char *file_path, const esp_lcd_touch_virtual_sample_t *samples, size_t samples_count)
+{
+    ESP_RETURN_ON_FALSE(file_path, ESP_ERR_INVALID_ARG, TAG, "Invalid file path");
+    ESP_RETURN_ON_FALSE(samples || samples_count == 0, ESP_ERR_INVALID_ARG, TAG, "Invalid samples");
+
+    FILE *f = fopen(file_path, "w");
+    ESP_RETURN_ON_FALSE(f, ESP_FAIL, TAG, "Open trace file %s failed", file_path);
+
+    fprintf(f, "# time_us points [x y strength]...\n");
+    for (size_t i = 0; i < samples_count; i++) {
+        const uint8_t points = (samples[i].points > CONFIG_ESP_LCD_TOUCH_MAX_POINTS ? CONFIG_ESP_LCD_TOUCH_MAX_POINTS : samples[i].points);
+        fprintf(f, "%" PRIu32 " %u", samples[i].time_us, points);
+        for (int j = 0; j < points; j++) {
+            fprintf(f, " %u %u %u", samples[i].coords[j].x, samples[i].coords[j].y, samples[i].coords[j].strength);
+        }
+        fprintf(f, "\n");
+    }
+
+    const bool failed = ferror(f);
+    if (fclose(f) != 0 || failed) {
+        ESP_LOGE(TAG, "Write trace file %s failed", file_path);
+        return ESP_FAIL;
+    }
+
+    return ESP_OK;
+}
+
+static esp_err_t read_data(esp_lcd_touch_handle_t tp)
+{
+    virtual_touch_t *vt = VIRTUAL_TOUCH(tp);
+    esp_lcd_touch_sample_t sample = {0};
+
+    if (vt->source) {
+        /* Record: each new sample of the source is appended to the trace and published */
+        ESP_RETURN_ON_ERROR(esp_lcd_touch_read_data(vt->source), TAG, "Read source touch failed");
+        esp_lcd_touch_peek_sample(vt->source, &sample);
+        if (sample.seq == vt->source_seq) {
+            return ESP_OK;
+        }
+        vt->source_seq = sample.seq;
+
+        if (vt->samples_count < vt->samples_max) {
+            esp_lcd_touch_virtual_sample_t *rec = &vt->samples_alloc[vt->samples_count];
+            rec->time_us = (uint32_t)(sample.timestamp_us - vt->first_start_us);
+            rec->points = sample.points;
+            memcpy(rec->coords, sample.coords, sample.points * sizeof(rec->coords[0]));
+            portENTER_CRITICAL(&vt->lock);
+            vt->samples_count++;
+            portEXIT_CRITICAL(&vt->lock);
+        }
+        esp_lcd_touch_publish_sample(tp, &sample);
+
+        return ESP_OK;
+    }
+
+    /* Playback: the last due sample is published once with its trace time */
+    portENTER_CRITICAL(&vt->lock);
+    const uint32_t due_seq = vt->due_seq;
+    const size_t due = vt->due;
+    sample.timestamp_us = vt->due_time_us;
+    portEXIT_CRITICAL(&vt->lock);
+
+    if (due_seq != vt->read_seq) {
+        vt->read_seq = due_seq;
+        vt->held = (vt->samples[due].points > 0 ? (int)due : -1);
+    } else if (vt->held >= 0) {
+        /* Held touch is reported by every read, as the controllers do it */
+        sample.timestamp_us = 0;
+    } else {
+        return ESP_OK;
+    }
+
+    const esp_lcd_touch_virtual_sample_t *src = &vt->samples[(vt->held >= 0 ? vt->held : due)];
+    sample.points = (src->points > CONFIG_ESP_LCD_TOUCH_MAX_POINTS ? CONFIG_ESP_LCD_TOUCH_MAX_POINTS : src->points);
+    memcpy(sample.coords, src->coords, sample.points * sizeof(sample.coords[0]));
+    esp_lcd_touch_publish_sample(tp, &sample);
+
+    return ESP_OK;
+}
+
+static esp_err_t del(esp_lcd_touch_handle_t tp)
+{
+    virtual_touch_t *vt = VIRTUAL_TOUCH(tp);
+
+    if (vt->timer) {
+        esp_timer_stop(vt->timer);
+        esp_timer_delete(vt->timer);
+    }
+    /* Reset GPIO pin settings, the pin of the recorded touch belongs to the source driver */
+    if (tp->config.int_gpio_num != GPIO_NUM_NC) {
+        if (tp->config.interrupt_callback) {
+            gpio_isr_handler_remove(tp->config.int_gpio_num);
+        }
+        if (!vt->source) {
+            gpio_reset_pin(tp->config.int_gpio_num);
+        }
+    }
+    /* Release memory */
+    free(vt->samples_alloc);
+    free(vt);
+
+    return ESP_OK;
+}
+
+/* Change level of the interrupt pin, its edge calls the interrupt callback through the GPIO interrupt */
+static void virtual_raise_interrupt(virtual_touch_t *vt)
+{
+    const gpio_num_t pin = vt->base.config.int_gpio_num;
+    if (pin != GPIO_NUM_NC) {
+        gpio_set_level(pin, vt->base.config.levels.interrupt);
+        gpio_set_level(pin, !vt->base.config.levels.interrupt);
+    }
+}
+
+static void virtual_timer_cb(void *arg)
+{
+    virtual_touch_t *vt = (virtual_touch_t *)arg;
+    const int64_t now = esp_timer_get_time();
+    bool due = false;
+    int64_t wait_us = 0;
+
+    portENTER_CRITICAL(&vt->lock);
+    /* All samples, which are due, are reported by one interrupt (the controller reports only its last state) */
+    while (vt->running && vt->start_us + vt->samples[vt->next].time_us <= now) {
+        vt->due = vt->next;
+        vt->due_time_us = vt->start_us + vt->samples[vt->next].time_us;
+        vt->due_seq++;
+        vt->reported++;
+        due = true;
+
+        if (++vt->next == vt->samples_count) {
+            vt->loops++;
+            vt->next = 0;
+            /* Next loop starts at the time of the last sample */
+            vt->start_us += vt->samples[vt->samples_count - 1].time_us;
+            vt->running = vt->loop;
+        }
+    }
+    if (vt->running) {
+        wait_us = vt->start_us + vt->samples[vt->next].time_us - now;
+    }
+    portEXIT_CRITICAL(&vt->lock);
+
+    if (due) {
+        virtual_raise_interrupt(vt);
+    }
+    if (wait_us > 0) {
+        esp_timer_start_once(vt->timer, wait_us);
+    }
+}
+
+static esp_err_t virtual_check_trace(virtual_touch_t *vt)
+{
+    ESP_RETURN_ON_FALSE(vt->samples_count > 0, ESP_ERR_INVALID_ARG, TAG, "Trace is empty");
+    for (size_t i = 1; i < vt->samples_count; i++) {
+        ESP_RETURN_ON_FALSE(vt->samples[i].time_us >= vt->samples[i - 1].time_us, ESP_ERR_INVALID_ARG, TAG,
+                            "Time of sample %u is before the previous one", (unsigned int)i);
+    }
+    ESP_RETURN_ON_FALSE(!vt->loop || vt->samples[vt->samples_count - 1].time_us > 0, ESP_ERR_INVALID_ARG, TAG,
+                        "Looped trace must have non-zero duration");
+
+    return ESP_OK;
+}
+
+/* Parse one line of the trace file, returns false for empty and comment lines */
+static bool virtual_parse_line(char *line, int line_num, esp_lcd_touch_virtual_sample_t *sample, esp_err_t *err)
+{
+    unsigned long values[VIRTUAL_TRACE_VALUES];
+    int count = 0;
+    char *p = line;
+
+    *err = ESP_OK;
+    while (isspace((unsigned char)*p)) {
+        p++;
+    }
+    if (*p == '\0' || *p == '#') {
+        return false;
+    }
+
+    while (count < VIRTUAL_TRACE_VALUES) {
+        char *end = NULL;
+        const unsigned long value = strtoul(p, &end, 10);
+        if (end == p) {
+            break;
+        }
+        values[count++] = value;
+        p = end;
+    }
+
+    /* Points over CONFIG_ESP_LCD_TOUCH_MAX_POINTS are ignored */
+    int points = 0;
+    if (count >= 2) {
+        points = (values[1] > CONFIG_ESP_LCD_TOUCH_MAX_POINTS ? CONFIG_ESP_LCD_TOUCH_MAX_POINTS : (int)values[1]);
+    }
+    if (count < 2 || count < 2 + (3 * points) || values[0] > UINT32_MAX) {
+        ESP_LOGE(TAG, "Invalid sample on line %d", line_num);
+        *err = ESP_ERR_INVALID_ARG;
+        return false;
+    }
+
+    memset(sample, 0, sizeof(esp_lcd_touch_virtual_sample_t));
+    sample->time_us = values[0];
+    sample->points = points;
+    for (int i = 0; i < points; i++) {
+        sample->coords[i].x = values[2 + (i * 3)];
+        sample->coords[i].y = values[3 + (i * 3)];
+        sample->coords[i].strength = values[4 + (i * 3)];
+    }
+
+    return true;
+}
+
+static esp_err_t virtual_load_trace(virtual_touch_t *vt, const char *file_path)
+{
+    esp_err_t ret = ESP_OK;
+    char line[VIRTUAL_TRACE_LINE_LEN];
+    int line_num = 0;
+    size_t size = 0;
+
+    FILE *f = fopen(file_path, "r");
+    ESP_RETURN_ON_FALSE(f, ESP_ERR_NOT_FOUND, TAG, "Open trace file %s failed", file_path);
+
+    while (fgets(line, sizeof(line), f)) {
+        line_num++;
+        if (vt->samples_count == size) {
+            esp_lcd_touch_virtual_sample_t *samples = realloc(vt->samples_alloc, (size + VIRTUAL_TRACE_GROW) * sizeof(esp_lcd_touch_virtual_sample_t));
+            ESP_GOTO_ON_FALSE(samples, ESP_ERR_NO_MEM, err, TAG, "Trace malloc failed");
+            vt->samples_alloc = samples;
+            size += VIRTUAL_TRACE_GROW;
+        }
+        if (virtual_parse_line(line, line_num, &vt->samples_alloc[vt->samples_count], &ret)) {
+            vt->samples_count++;
+        }
+        ESP_GOTO_ON_ERROR(ret, err, TAG, "Parse trace file %s failed", file_path);
+    }
+    vt->samples = vt->samples_alloc;
+
+err:
+    fclose(f);
+    return ret;
+}
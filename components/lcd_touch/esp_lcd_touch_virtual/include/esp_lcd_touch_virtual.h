@@ -0,0 +1,154 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief ESP LCD touch: Virtual touch controller (trace playback and recording)
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "esp_lcd_touch.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief One sample of a touch trace
+ */
+typedef struct {
+    uint32_t time_us;   /*!< Time of the sample from the start of the trace */
+    uint8_t points;     /*!< Count of touch points (0 = released) */
+    struct {
+        uint16_t x;         /*!< X coordinate */
+        uint16_t y;         /*!< Y coordinate */
+        uint16_t strength;  /*!< Strength */
+    } coords[CONFIG_ESP_LCD_TOUCH_MAX_POINTS];
+} esp_lcd_touch_virtual_sample_t;
+
+/**
+ * @brief Virtual touch configuration type
+ *
+ * Playback mode (`source` is NULL): samples of the trace are reported at their times after esp_lcd_touch_virtual_start().
+ * The trace is taken from `samples` or loaded from the text file `file_path`.
+ *
+ * Record mode: every sample published by the `source` touch driver is reported by the virtual touch and appended
+ * to the trace (up to `samples_count` samples). The virtual touch is used instead of the source one.
+ */
+typedef struct {
+    esp_lcd_touch_handle_t source;                  /*!< Record mode: recorded touch driver (NULL = playback mode) */
+    const esp_lcd_touch_virtual_sample_t *samples;  /*!< Playback: trace in memory, it must be valid until the touch is deleted (NULL = load `file_path`) */
+    size_t samples_count;                           /*!< Playback: count of samples in `samples`. Record: maximum count of recorded samples */
+    const char *file_path;                          /*!< Playback: trace file, see esp_lcd_touch_virtual_save_trace() */
+    struct {
+        unsigned int loop: 1;                       /*!< Playback: repeat the trace, the next loop starts at the time of the last sample */
+    } flags;
+} esp_lcd_touch_virtual_config_t;
+
+/**
+ * @brief Virtual touch status
+ */
+typedef struct {
+    bool running;       /*!< Playback is running */
+    int64_t start_us;   /*!< Time of the trace start (esp_timer_get_time()), a sample is touched at start_us + time_us */
+    uint32_t reported;  /*!< Playback: count of reported trace samples. Record: count of recorded samples */
+    uint32_t loops;     /*!< Playback: count of finished loops of the trace */
+} esp_lcd_touch_virtual_status_t;
+
+/**
+ * @brief Create a new virtual touch driver
+ *
+ * The virtual touch behaves like a touch controller with interrupt. When a sample of the trace is due, its level
+ * is changed on the interrupt pin `int_gpio_num` (if it is set), so the interrupt callback of esp_lcd_touch is called
+ * by the GPIO interrupt as with a real controller. The pin is configured as input and output, it must not be connected
+ * to anything else. The sample is published by the next esp_lcd_touch_read_data(), with the trace time as its
+ * timestamp. A held touch is reported by every read, as the touch controllers do it.
+ *
+ * In record mode, the interrupt pin and all other settings are taken from the source touch.
+ *
+ * @note Virtual touch configuration (esp_lcd_touch_virtual_config_t) must be set in `driver_data` of `config`.
+ *
+ * @param config: Touch configuration
+ * @param out_touch: Touch instance handle
+ * @return
+ *      - ESP_OK                    on success
+ *      - ESP_ERR_INVALID_ARG       if parameter is invalid or the trace file cannot be parsed
+ *      - ESP_ERR_NOT_FOUND         if the trace file cannot be opened
+ *      - ESP_ERR_NO_MEM            if there is no memory for allocating main structure or the trace
+ */
+esp_err_t esp_lcd_touch_new_virtual(const esp_lcd_touch_config_t *config, esp_lcd_touch_handle_t *out_touch);
+
+/**
+ * @brief Start playback of the trace from its first sample
+ *
+ * @param tp: Virtual touch handle (playback mode)
+ * @return
+ *      - ESP_OK                    on success
+ *      - ESP_ERR_INVALID_ARG       if parameter is invalid
+ *      - ESP_ERR_NOT_SUPPORTED     if the touch is in record mode
+ */
+esp_err_t esp_lcd_touch_virtual_start(esp_lcd_touch_handle_t tp);
+
+/**
+ * @brief Stop playback of the trace
+ *
+ * @param tp: Virtual touch handle (playback mode)
+ * @return
+ *      - ESP_OK                    on success
+ *      - ESP_ERR_INVALID_ARG       if parameter is invalid
+ *      - ESP_ERR_NOT_SUPPORTED     if the touch is in record mode
+ */
+esp_err_t esp_lcd_touch_virtual_stop(esp_lcd_touch_handle_t tp);
+
+/**
+ * @brief Get status of the playback or recording
+ *
+ * @param tp: Virtual touch handle
+ * @param status: Status
+ * @return
+ *      - ESP_OK                    on success
+ *      - ESP_ERR_INVALID_ARG       if parameter is invalid
+ */
+esp_err_t esp_lcd_touch_virtual_get_status(esp_lcd_touch_handle_t tp, esp_lcd_touch_virtual_status_t *status);
+
+/**
+ * @brief Get the trace of the virtual touch (played or recorded)
+ *
+ * @note Recorded trace is valid until the touch is deleted, it grows with the next esp_lcd_touch_read_data() calls.
+ *
+ * @param tp: Virtual touch handle
+ * @param samples: Samples of the trace
+ * @param samples_count: Count of samples
+ * @return
+ *      - ESP_OK                    on success
+ *      - ESP_ERR_INVALID_ARG       if parameter is invalid
+ */
+esp_err_t esp_lcd_touch_virtual_get_trace(esp_lcd_touch_handle_t tp, const esp_lcd_touch_virtual_sample_t **samples, size_t *samples_count);
+
+/**
+ * @brief Save a trace into a text file
+ *
+ * One sample per line: `<time_us> <points> [<x> <y> <strength>]...`. Empty lines and lines starting with `#` are
+ * ignored by the playback, so a trace can also be written by hand.
+ *
+ * @param file_path: Path of the trace file
+ * @param samples: Samples of the trace
+ * @param samples_count: Count of samples
+ * @return
+ *      - ESP_OK                    on success
+ *      - ESP_ERR_INVALID_ARG       if parameter is invalid
+ *      - ESP_FAIL                  if the file cannot be written
+ */
+esp_err_t esp_lcd_touch_virtual_save_trace(const char *file_path, const esp_lcd_touch_virtual_sample_t *samples, size_t samples_count);
+
+#ifdef __cplusplus
+}
+#endif